@@ -0,0 +1,115 @@
+// Benchmark includes.
+#include "MapBenchmark.h"
+#include "LineBenchmark.h"
+#include "LayoutBenchmark.h"
+#include "QueryBenchmark.h"
+
+// Generation includes.
+#include "CavernGenerator.h"
+#include "DungeonGenerator.h"
+
+// Utility includes.
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// <summary> Generates seeded maps with every generator across a sweep of sizes, then writes a summary of each generator and size, followed by comparisons of the line functions, of the old and current tile layouts, and of the dungeon cell queries through the adapter and the view. </summary>
+/// <remarks> Takes <c>--runs N</c>, <c>--seed S</c>, <c>--sizes A,B,C</c>, <c>--lines L</c>, <c>--layouts A,B,C</c>, <c>--queries Q</c>, <c>--passes P</c>, and <c>--csv</c>. Fails if the line functions, the tile layouts, or the ways of querying cells disagree. </remarks>
+int main(int argc, char * argv[])
+{
+	// The settings, which can be changed by the arguments.
+	uint32_t runs = 20;
+	uint32_t seed = 1;
+	std::vector<uint32_t> sizes = { 55, 111, 223 };
+	uint32_t lines = 100000;
+	std::vector<uint32_t> layoutSizes = { 55, 512, 4096 };
+	uint32_t queries = 1000000;
+	uint32_t passes = 50;
+	bool isCSV = false;
+
+	// Read the arguments.
+	for (int32_t i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--runs" && i + 1 < argc)		{ runs = (uint32_t)std::stoul(argv[++i]); }
+		else if (argument == "--seed" && i + 1 < argc)	{ seed = (uint32_t)std::stoul(argv[++i]); }
+		else if (argument == "--lines" && i + 1 < argc)	{ lines = (uint32_t)std::stoul(argv[++i]); }
+		else if (argument == "--queries" && i + 1 < argc)	{ queries = (uint32_t)std::stoul(argv[++i]); }
+		else if (argument == "--passes" && i + 1 < argc)	{ passes = (uint32_t)std::stoul(argv[++i]); }
+		else if (argument == "--csv")					{ isCSV = true; }
+		else if (argument == "--sizes" && i + 1 < argc)
+		{
+			// Read the comma separated sizes.
+			sizes.clear();
+			std::istringstream sizeStream(argv[++i]);
+			std::string size;
+			while (std::getline(sizeStream, size, ',')) { sizes.push_back((uint32_t)std::stoul(size)); }
+		}
+		else if (argument == "--layouts" && i + 1 < argc)
+		{
+			// Read the comma separated layout sizes.
+			layoutSizes.clear();
+			std::istringstream sizeStream(argv[++i]);
+			std::string size;
+			while (std::getline(sizeStream, size, ',')) { layoutSizes.push_back((uint32_t)std::stoul(size)); }
+		}
+		else { std::cerr << "Usage: " << argv[0] << " [--runs N] [--seed S] [--sizes A,B,C] [--lines L] [--layouts A,B,C] [--queries Q] [--passes P] [--csv]" << std::endl; return 1; }
+	}
+
+	// Run each generator over every size.
+	Benchmarks::MapBenchmark benchmark(runs, seed);
+	Benchmarks::MapBenchmark::WriteHeader(std::cout, isCSV);
+	for (size_t i = 0; i < sizes.size(); i++)
+	{
+		Benchmarks::MapBenchmark::WriteSummary(std::cout, "cavern", sizes[i], benchmark.Run([]() { return new MapGeneration::CavernGenerator(); }, sizes[i]), isCSV);
+		Benchmarks::MapBenchmark::WriteSummary(std::cout, "dungeon", sizes[i], benchmark.Run([]() { return new MapGeneration::DungeonGenerator(); }, sizes[i]), isCSV);
+		Benchmarks::MapBenchmark::WriteSummary(std::cout, "dungeon4", sizes[i], benchmark.Run([]() { return new MapGeneration::DungeonGenerator(4); }, sizes[i]), isCSV);
+	}
+
+	// Compare the line functions over lines as long as the largest map.
+	uint32_t mismatches = 0;
+	if (lines > 0 && !sizes.empty())
+	{
+		Benchmarks::LineSample lineSample = Benchmarks::LineBenchmark(lines, seed, (int32_t)*std::max_element(sizes.begin(), sizes.end())).Run();
+		std::cout << std::endl;
+		Benchmarks::LineBenchmark::WriteSummary(std::cout, lineSample, isCSV);
+		mismatches += lineSample.m_mismatches;
+	}
+
+	// Compare the old column layout of the tile map with the current storage over every layout size.
+	if (!layoutSizes.empty())
+	{
+		Benchmarks::LayoutBenchmark layoutBenchmark(queries, seed);
+		std::cout << std::endl;
+		Benchmarks::LayoutBenchmark::WriteHeader(std::cout, isCSV);
+		uint32_t slower = 0;
+		for (size_t i = 0; i < layoutSizes.size(); i++)
+		{
+			Benchmarks::LayoutSample layoutSample = layoutBenchmark.Run(layoutSizes[i]);
+			Benchmarks::LayoutBenchmark::WriteSummary(std::cout, layoutSample, isCSV);
+			mismatches += layoutSample.m_mismatches;
+			slower += layoutSample.m_slower;
+		}
+
+		// Warn about any measurement where the storage lost, without failing, as the times depend on the machine.
+		if (slower > 0) { std::cerr << "Warning: the storage was more than " << Benchmarks::LayoutBenchmark::c_slowerTolerance << " times slower than the old layout in " << slower << " measurements." << std::endl; }
+	}
+
+	// Compare the dungeon cell queries through the adapter and the view over every size.
+	if (passes > 0 && !sizes.empty())
+	{
+		Benchmarks::QueryBenchmark queryBenchmark(passes, seed);
+		std::cout << std::endl;
+		Benchmarks::QueryBenchmark::WriteHeader(std::cout, isCSV);
+		for (size_t i = 0; i < sizes.size(); i++)
+		{
+			Benchmarks::QuerySample querySample = queryBenchmark.Run(sizes[i]);
+			Benchmarks::QueryBenchmark::WriteSummary(std::cout, querySample, isCSV);
+			mismatches += querySample.m_mismatches;
+		}
+	}
+
+	return (mismatches == 0) ? 0 : 1;
+}
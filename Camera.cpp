@@ -1,8 +1,10 @@
 #include "Camera.h"
 
+// Framework includes.
+#include <SDL_events.h>
+
 // Data includes.
 #include "World.h"
-#include "IReadOnlyTileMap.h"
 
 // Service includes.
 #include "Graphics.h"
@@ -11,6 +13,17 @@
 // Utility includes.
 #include "SpriteData.h"
 
+/// <summary> Initialises the UI and event bindings. </summary>
+/// <param name="_events"> The events bus. </param>
+void WorldObjects::Camera::Initialise(Events::Events& _events)
+{
+	// Initialise the UI.
+	m_gameMenu.Initialise(_events);
+
+	// If the renderer loses what was drawn to the canvases, every chunk must be redrawn.
+	_events.AddFrameworkListener(SDL_RENDER_TARGETS_RESET, std::bind(&Camera::markAllChunksDirty, this, std::placeholders::_1));
+}
+
 /// <summary> Draws the given world from the <see cref="Camera"/>'s perspective. </summary>
 /// <param name="_world"> The world to draw. </param>
 /// <param name="_services"> The service provider. </param>
@@ -20,31 +33,22 @@ void WorldObjects::Camera::Draw(World& _world, Services::ServiceProvider& _servi
 	Graphics::Graphics& graphics = _services.GetService<Graphics::Graphics>(Services::ServiceType::Graphics);
 	Screens::Screen& screen = _services.GetService<Screens::Screen>(Services::ServiceType::Screen);
 
-	// Get the tiledata.
-	IReadOnlyTileMap& tileMap = _world.GetTileMap();
+	// Get a view of the tiledata.
+	TileMap::View tileMap = _world.GetTileMapView();
 
 	// Centre on the player.
 	centreOnMapObject(_world.GetPlayer());
 
-	// Draw the map data based on the visible area of the camera.
-	for (int32_t x = std::max(0, m_worldPosition.x / SpriteData::c_tileSize); x < std::min((int32_t)tileMap.GetWidth(), ((m_worldPosition.x + 832) / SpriteData::c_tileSize) + 1); x++)
-	{
-		for (int32_t y = std::max(0, m_worldPosition.y / SpriteData::c_tileSize); y < std::min((int32_t)tileMap.GetHeight(), ((m_worldPosition.y + m_worldSize.y) / SpriteData::c_tileSize) + 1); y++)
-		{
-			// If the tile is not visible, skip it.
-			if (!tileMap.GetTileAt(Point(x, y)).m_visibility) { continue; }
+	// Calculate the area of tiles that can be seen.
+	int32_t minX = std::max(0, m_worldPosition.x / SpriteData::c_tileSize);
+	int32_t minY = std::max(0, m_worldPosition.y / SpriteData::c_tileSize);
+	int32_t maxX = std::min((int32_t)tileMap.GetWidth(), ((m_worldPosition.x + c_mapViewWidth) / SpriteData::c_tileSize) + 1);
+	int32_t maxY = std::min((int32_t)tileMap.GetHeight(), ((m_worldPosition.y + m_worldSize.y) / SpriteData::c_tileSize) + 1);
+	Rectangle visibleTiles(minX, minY, std::max(0, maxX - minX), std::max(0, maxY - minY));
 
-			// Calculate the window position.
-			Point windowPosition = screen.ScreenToWindowSpace((Point(x, y) * SpriteData::c_tileSize) - m_worldPosition);
-
-			// Calculate the sprite ID by the prosperity.
-			uint16_t spriteID = tileMap.GetTileAt(Point(x, y)).m_ID;
-			if (tileMap.GetTileAt(Point(x, y)).m_prosperity > 0) { spriteID = SpriteData::TileID::LowGems + (tileMap.GetTileAt(Point(x, y)).m_prosperity / 64); }
-
-			// Draw the tile.
-			graphics.Draw(SpriteData::SheetID::Tiles, spriteID, Rectangle(windowPosition, screen.ScreenToWindowSize(SpriteData::c_tileSize)));
-		}
-	}
+	// Draw the map data based on the visible area of the camera.
+	if (m_isChunkCacheEnabled)	{ drawChunks(_world, visibleTiles, graphics, screen); }
+	else						{ drawTiles(_world, visibleTiles, graphics, screen); }
 
 	// Draw the spawn and exit points if they're on screen.
 	if (isOnScreen(_world.GetSpawn())) { _world.GetSpawn().Draw(m_worldPosition, _services); }
@@ -55,4 +59,167 @@ void WorldObjects::Camera::Draw(World& _world, Services::ServiceProvider& _servi
 
 	// Draw the UI.
 	m_gameMenu.Draw(_world, _services);
-}
\ No newline at end of file
+}
+
+/// <summary> Draws each of the given tiles individually. </summary>
+/// <param name="_world"> The world to draw. </param>
+/// <param name="_visibleTiles"> The area of tiles to draw. </param>
+/// <param name="_graphics"> The graphics service. </param>
+/// <param name="_screen"> The screen service. </param>
+void WorldObjects::Camera::drawTiles(World& _world, const Rectangle _visibleTiles, Graphics::Graphics& _graphics, Screens::Screen& _screen)
+{
+	// Get a view of the tiledata.
+	TileMap::View tileMap = _world.GetTileMapView();
+
+	// Every tile comes from the same sheet, so batch them together.
+	_graphics.BeginBatch();
+	tileMap.VisitTiles(_visibleTiles, [this, &_graphics, &_screen](const Point _position, const Tile _tile)
+	{
+		// If the tile is not visible, skip it.
+		if (!_tile.m_visibility) { return; }
+
+		// Calculate the window position.
+		Point windowPosition = _screen.ScreenToWindowSpace((_position * SpriteData::c_tileSize) - m_worldPosition);
+
+		// Calculate the sprite ID by the prosperity.
+		uint16_t spriteID = _tile.m_ID;
+		if (_tile.m_prosperity > 0) { spriteID = SpriteData::TileID::LowGems + (_tile.m_prosperity / 64); }
+
+		// Draw the tile.
+		_graphics.Draw(SpriteData::SheetID::Tiles, spriteID, Rectangle(windowPosition, _screen.ScreenToWindowSize(SpriteData::c_tileSize)));
+	});
+	_graphics.EndBatch();
+}
+
+/// <summary> Draws the chunks covering the given tiles, rebaking any that have changed. </summary>
+/// <param name="_world"> The world to draw. </param>
+/// <param name="_visibleTiles"> The area of tiles to draw. </param>
+/// <param name="_graphics"> The graphics service. </param>
+/// <param name="_screen"> The screen service. </param>
+void WorldObjects::Camera::drawChunks(World& _world, const Rectangle _visibleTiles, Graphics::Graphics& _graphics, Screens::Screen& _screen)
+{
+	// Mark any chunks with changed tiles as dirty, then move onto the next frame.
+	markChunksDirty(_world);
+	m_frameCount++;
+
+	// Nothing can be seen, so nothing needs to be drawn.
+	if (_visibleTiles.w <= 0 || _visibleTiles.h <= 0) { return; }
+
+	// The size of a chunk in screen pixels.
+	const int32_t chunkPixels = c_chunkSize * SpriteData::c_tileSize;
+
+	// Go over each chunk that can be seen.
+	for (int32_t chunkY = _visibleTiles.y / c_chunkSize; chunkY <= (_visibleTiles.GetMaxY() - 1) / c_chunkSize; chunkY++)
+	{
+		for (int32_t chunkX = _visibleTiles.x / c_chunkSize; chunkX <= (_visibleTiles.GetMaxX() - 1) / c_chunkSize; chunkX++)
+		{
+			// Get the chunk, baking it if it has changed or was not yet baked.
+			BakedChunk& chunk = getBakedChunk(Point(chunkX, chunkY), _graphics);
+			if (chunk.m_isDirty) { bakeChunk(_world, chunk, _graphics); }
+			chunk.m_lastUsedFrame = m_frameCount;
+
+			// Clip the chunk to the part of the screen that shows the map, so that it does not spill past the edges.
+			Point screenPosition = Point(chunkX, chunkY) * chunkPixels - m_worldPosition;
+			Point clippedStart = Point(std::max(0, screenPosition.x), std::max(0, screenPosition.y));
+			Point clippedEnd = Point(std::min(c_mapViewWidth, screenPosition.x + chunkPixels), std::min(m_worldSize.y, screenPosition.y + chunkPixels));
+			if (clippedEnd.x <= clippedStart.x || clippedEnd.y <= clippedStart.y) { continue; }
+
+			// Calculate the window bounds from both corners, so that neighbouring chunks meet without gaps when scaled.
+			Point windowStart = _screen.ScreenToWindowSpace(clippedStart);
+			Point windowEnd = _screen.ScreenToWindowSpace(clippedEnd);
+
+			// Draw the clipped part of the chunk.
+			_graphics.DrawCanvas(chunk.m_canvasID, Rectangle(windowStart, windowEnd - windowStart), Rectangle(clippedStart - screenPosition, clippedEnd - clippedStart));
+		}
+	}
+}
+
+/// <summary> Gets the baked chunk at the given position, taking a canvas for it if it has not been baked. </summary>
+/// <param name="_chunkPosition"> The position of the chunk, in chunks. </param>
+/// <param name="_graphics"> The graphics service. </param>
+/// <returns> The baked chunk, which will be dirty if it must be drawn before it is used. </returns>
+WorldObjects::Camera::BakedChunk& WorldObjects::Camera::getBakedChunk(const Point _chunkPosition, Graphics::Graphics& _graphics)
+{
+	// If the chunk has already been baked, return it.
+	for (size_t i = 0; i < m_bakedChunks.size(); i++) { if (m_bakedChunks[i].m_chunkPosition == _chunkPosition) { return m_bakedChunks[i]; } }
+
+	// If there are still canvases to spare, make a new one.
+	if (m_bakedChunks.size() < c_maxBakedChunks)
+	{
+		BakedChunk chunk;
+		chunk.m_canvasID = SpriteData::CanvasID::CameraChunks + (uint16_t)m_bakedChunks.size();
+		_graphics.CreateTargetCanvas(chunk.m_canvasID, Point(c_chunkSize * SpriteData::c_tileSize));
+		m_bakedChunks.push_back(chunk);
+	}
+
+	// Otherwise, reuse the canvas of the chunk that was drawn the longest time ago.
+	else
+	{
+		size_t oldestIndex = 0;
+		for (size_t i = 1; i < m_bakedChunks.size(); i++) { if (m_bakedChunks[i].m_lastUsedFrame < m_bakedChunks[oldestIndex].m_lastUsedFrame) { oldestIndex = i; } }
+		std::swap(m_bakedChunks[oldestIndex], m_bakedChunks.back());
+	}
+
+	// Set up the chunk for the new position, it must be drawn before it can be used.
+	BakedChunk& chunk = m_bakedChunks.back();
+	chunk.m_chunkPosition = _chunkPosition;
+	chunk.m_isDirty = true;
+	chunk.m_lastUsedFrame = m_frameCount;
+	return chunk;
+}
+
+/// <summary> Draws every tile within the given chunk to its canvas. </summary>
+/// <param name="_world"> The world to draw. </param>
+/// <param name="_chunk"> The chunk to draw. </param>
+/// <param name="_graphics"> The graphics service. </param>
+void WorldObjects::Camera::bakeChunk(World& _world, BakedChunk& _chunk, Graphics::Graphics& _graphics)
+{
+	// Get a view of the tiledata, and the area of the chunk on the map.
+	TileMap::View tileMap = _world.GetTileMapView();
+	Rectangle chunkTiles = tileMap.ClipToMap(Rectangle(_chunk.m_chunkPosition * c_chunkSize, Point(c_chunkSize)));
+
+	// Draw onto the canvas of the chunk, starting fully transparent.
+	_graphics.BeginCanvasDraw(_chunk.m_canvasID);
+	_graphics.Clear({ 0, 0, 0, 0 });
+
+	// Every tile comes from the same sheet, so batch them together.
+	_graphics.BeginBatch();
+	tileMap.VisitTiles(chunkTiles, [&_chunk, &_graphics](const Point _position, const Tile _tile)
+	{
+		// If the tile is not visible, skip it.
+		if (!_tile.m_visibility) { return; }
+
+		// Calculate the sprite ID by the prosperity.
+		uint16_t spriteID = _tile.m_ID;
+		if (_tile.m_prosperity > 0) { spriteID = SpriteData::TileID::LowGems + (_tile.m_prosperity / 64); }
+
+		// Draw the tile relative to the chunk at its original size.
+		_graphics.Draw(SpriteData::SheetID::Tiles, spriteID, Rectangle((_position - _chunk.m_chunkPosition * c_chunkSize) * SpriteData::c_tileSize, Point(SpriteData::c_tileSize)));
+	});
+	_graphics.EndBatch();
+
+	// Go back to drawing to the screen.
+	_graphics.EndCanvasDraw();
+	_chunk.m_isDirty = false;
+}
+
+/// <summary> Marks every baked chunk containing a tile that has changed since the last frame as dirty. </summary>
+/// <param name="_world"> The world whose changes should be taken. </param>
+void WorldObjects::Camera::markChunksDirty(World& _world)
+{
+	// If this has not yet been registered for changes to the map, do so. This starts with the whole map changed.
+	IReadOnlyTileMap& tileMap = _world.GetTileMap();
+	if (!m_hasDirtyConsumer)
+	{
+		m_dirtyConsumerID = tileMap.RegisterDirtyConsumer();
+		m_hasDirtyConsumer = true;
+	}
+
+	// Mark each baked chunk that overlaps a changed region.
+	std::vector<Rectangle> dirtyRegions = tileMap.ConsumeDirtyRegions(m_dirtyConsumerID);
+	for (size_t i = 0; i < m_bakedChunks.size(); i++)
+	{
+		Rectangle chunkTiles(m_bakedChunks[i].m_chunkPosition * c_chunkSize, Point(c_chunkSize));
+		for (size_t j = 0; j < dirtyRegions.size() && !m_bakedChunks[i].m_isDirty; j++) { if (chunkTiles.Intersects(dirtyRegions[j])) { m_bakedChunks[i].m_isDirty = true; } }
+	}
+}
@@ -14,10 +14,15 @@
 
 // Utility includes.
 #include "SpriteData.h"
+#include <vector>
 
 // UI includes.
 #include "GameMenu.h"
 
+// Forward declaration.
+namespace Graphics { class Graphics; }
+namespace Screens { class Screen; }
+
 namespace WorldObjects
 {
 	// Forward declaration.
@@ -28,18 +33,44 @@ namespace WorldObjects
 	{
 	public:
 		/// <summary> Creates an empty <see cref="Camera"/>. </summary>
-		Camera() : m_worldPosition(Point(0, 0)), m_worldSize(Point(960, 540)), m_worldBounds(m_worldPosition, m_worldSize) { }
+		Camera() : m_worldPosition(Point(0, 0)), m_worldSize(Point(960, 540)), m_worldBounds(m_worldPosition, m_worldSize), m_bakedChunks(), m_isChunkCacheEnabled(true), m_hasDirtyConsumer(false), m_dirtyConsumerID(0), m_frameCount(0) { }
 
-		/// <summary> Initialises the UI. </summary>
-		/// <param name="_events"> The events bus. </param>
-		inline void Initialise(Events::Events& _events) { m_gameMenu.Initialise(_events); }
+		void Initialise(Events::Events&);
 
 		void Draw(World&, Services::ServiceProvider&);
 
+		/// <summary> Switches between drawing the map from baked chunks and drawing each tile individually. </summary>
+		inline void ToggleChunkCache() { m_isChunkCacheEnabled = !m_isChunkCacheEnabled; }
+
 		/// <summary> Gets the position of the camera within the world. </summary>
 		/// <returns> The camera's world position. </returns>
 		inline Point GetWorldPosition() const { return m_worldPosition; }
 	private:
+		/// <summary> The width of the screen that the map is drawn on, the rest being covered by the side bar. </summary>
+		static const int32_t		c_mapViewWidth = 832;
+
+		/// <summary> The width and height of a baked chunk, in tiles. </summary>
+		static const int32_t		c_chunkSize = 16;
+
+		/// <summary> The most chunks that will be kept baked at once, which must be more than can be seen at once. </summary>
+		static const uint16_t		c_maxBakedChunks = 32;
+
+		/// <summary> Represents a square block of tiles that has been drawn to a canvas. </summary>
+		struct BakedChunk
+		{
+			/// <summary> The position of the chunk, in chunks. </summary>
+			Point		m_chunkPosition;
+
+			/// <summary> The ID of the canvas to which the chunk is drawn. </summary>
+			uint16_t	m_canvasID;
+
+			/// <summary> <c>true</c> if a tile within the chunk has changed since it was last drawn; otherwise, <c>false</c>. </summary>
+			bool		m_isDirty;
+
+			/// <summary> The frame on which the chunk was last drawn to the screen. </summary>
+			uint32_t	m_lastUsedFrame;
+		};
+
 		/// <summary> The position of the camera in the world. </summary>
 		Point					m_worldPosition;
 
@@ -52,6 +83,34 @@ namespace WorldObjects
 		/// <summary> The UI for the main game. </summary>
 		UserInterface::GameMenu	m_gameMenu;
 
+		/// <summary> The chunks that have been baked, each with their own canvas. </summary>
+		std::vector<BakedChunk>	m_bakedChunks;
+
+		/// <summary> <c>true</c> if the map is drawn from baked chunks; otherwise, <c>false</c> to draw each tile individually. </summary>
+		bool					m_isChunkCacheEnabled;
+
+		/// <summary> <c>true</c> if this is registered for the changes to the map; otherwise, <c>false</c>. </summary>
+		bool					m_hasDirtyConsumer;
+
+		/// <summary> The ID given by the map with which to take its changes. </summary>
+		uint32_t				m_dirtyConsumerID;
+
+		/// <summary> The amount of frames that have been drawn, used to find which chunk was used least recently. </summary>
+		uint32_t				m_frameCount;
+
+		void drawTiles(World&, Rectangle, Graphics::Graphics&, Screens::Screen&);
+
+		void drawChunks(World&, Rectangle, Graphics::Graphics&, Screens::Screen&);
+
+		BakedChunk& getBakedChunk(Point, Graphics::Graphics&);
+
+		void bakeChunk(World&, BakedChunk&, Graphics::Graphics&);
+
+		void markChunksDirty(World&);
+
+		/// <summary> Marks every baked chunk as needing to be redrawn, as happens when the canvases lose what was drawn to them. </summary>
+		void markAllChunksDirty(Events::EventContext* = NULL) { for (size_t i = 0; i < m_bakedChunks.size(); i++) { m_bakedChunks[i].m_isDirty = true; } }
+
 		/// <summary> Centres this <see cref="Camera"/>'s view on the given <see cref="IReadOnlyMapObject"/>. </summary>
 		/// <param name="_mapObject"> The object to centre on. </param>
 		void centreOnMapObject(GameObjects::IReadOnlyMapObject& _mapObject) { m_worldPosition = ((_mapObject.GetTilePosition() * SpriteData::c_tileSize) + (SpriteData::c_tileSize / 2)) - (m_worldSize / 2); m_worldBounds.x = m_worldPosition.x; m_worldBounds.y = m_worldPosition.y; }
@@ -12,7 +12,7 @@ namespace MapGeneration
 	public:
 		CavernGenerator() {}
 
-		virtual void Generate(WorldObjects::TileMap&, GameObjects::MapObject&, GameObjects::MapObject&);
+		virtual void Generate(WorldObjects::TileMap&, Random::RandomStream&, GameObjects::MapObject&, GameObjects::MapObject&);
 	private:
 		/// <summary> The min percentage of all tiles on the map to turn into floors. <c>0</c> for none, <c>100</c> for all. </summary>
 		float				c_minPercentageOfMapToCarve = 0.5f;
@@ -25,8 +25,6 @@ namespace MapGeneration
 
 		/// <summary> The chance for each step to go closer towards the centre. <c>0</c> for no weighting, <c>100</c> for full weighting. </summary>
 		const float			c_centreWeight = 0.1f;
-
-		void generateGems(WorldObjects::TileMap&);
 	};
 }
 #endif
\ No newline at end of file
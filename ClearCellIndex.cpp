@@ -0,0 +1,61 @@
+#include "ClearCellIndex.h"
+
+// Define the constant, as it is passed by reference when filling the slots of a chunk.
+const uint32_t WorldObjects::ClearCellIndex::c_noSlot;
+
+/// <summary> Builds the index from every clear cell within the playable area of the given map. </summary>
+/// <param name="_view"> The view of the map. </param>
+void WorldObjects::ClearCellIndex::Build(const TileMapView<TileStorage> _view)
+{
+	// If the size of the map has changed, the chunks of slots no longer line up, so forget them.
+	if (m_width != _view.GetWidth() || m_height != _view.GetHeight())
+	{
+		m_width = _view.GetWidth();
+		m_height = _view.GetHeight();
+		m_chunksWide = (m_width + TileStorage::c_chunkMask) >> TileStorage::c_chunkShift;
+		m_chunkSlots.clear();
+		m_chunkSlots.resize(m_chunksWide * ((m_height + TileStorage::c_chunkMask) >> TileStorage::c_chunkShift));
+	}
+
+	// Start with no cell in the list, reusing the memory from the last build.
+	m_cells.clear();
+	for (size_t i = 0; i < m_chunkSlots.size(); i++) { if (m_chunkSlots[i] != nullptr) { m_chunkSlots[i]->fill(c_noSlot); } }
+
+	// Add every clear cell, leaving out the edges as they are never playable.
+	_view.VisitClearCells(Rectangle(1, 1, (int32_t)m_width - 2, (int32_t)m_height - 2), [this](const Point _position)
+	{
+		uint32_t cellIndex = _position.y * m_width + _position.x;
+		getOrCreateSlot(cellIndex) = (uint32_t)m_cells.size();
+		m_cells.push_back(cellIndex);
+	});
+
+	m_isBuilt = true;
+}
+
+/// <summary> Adds or removes the cell at the given position, depending on whether it is now clear. </summary>
+/// <param name="_position"> The position of the cell. </param>
+/// <param name="_isClear"> Is <c>true</c> if the cell is now clear; otherwise, <c>false</c>. </param>
+void WorldObjects::ClearCellIndex::SetCell(const Point _position, const bool _isClear)
+{
+	// If the index is not built, or the cell is outside of the playable area, there is nothing to update.
+	if (!m_isBuilt || _position.x <= 0 || _position.y <= 0 || _position.x >= (int32_t)m_width - 1 || _position.y >= (int32_t)m_height - 1) { return; }
+
+	uint32_t cellIndex = _position.y * m_width + _position.x;
+	uint32_t slot = findSlot(cellIndex);
+
+	// If the cell has become clear, add it to the end of the list.
+	if (_isClear && slot == c_noSlot)
+	{
+		getOrCreateSlot(cellIndex) = (uint32_t)m_cells.size();
+		m_cells.push_back(cellIndex);
+	}
+	// If the cell has been blocked, move the last cell into its slot.
+	else if (!_isClear && slot != c_noSlot)
+	{
+		uint32_t lastCellIndex = m_cells.back();
+		m_cells[slot] = lastCellIndex;
+		getOrCreateSlot(lastCellIndex) = slot;
+		m_cells.pop_back();
+		getOrCreateSlot(cellIndex) = c_noSlot;
+	}
+}
@@ -0,0 +1,101 @@
+#ifndef CLEARCELLINDEX_H
+#define CLEARCELLINDEX_H
+
+// Data includes.
+#include "TileStorage.h"
+#include "TileMapView.h"
+#include "Point.h"
+
+// Utility includes.
+#include <array>
+#include <memory>
+#include <vector>
+
+// Typedef includes.
+#include <stdint.h>
+
+namespace WorldObjects
+{
+	/// <summary> Represents an index of every clear cell within the playable area of a map, which can be sampled in constant time. </summary>
+	/// <remarks> The clear cells are kept in a dense list, with the slot of each cell in that list kept per cell so that a cell can be removed by swapping the last cell into its slot. The slots are kept in the same chunks as <see cref="TileStorage"/>, and a chunk of slots is only made once a cell within it is clear, so walls that were never dug cost nothing. The index starts unbuilt and ignores changes until it is built, so that generating a map does not pay for it. </remarks>
+	class ClearCellIndex
+	{
+	public:
+		/// <summary> The slot of a cell that is not in the list. </summary>
+		static const uint32_t c_noSlot = UINT32_MAX;
+
+		ClearCellIndex() : m_cells(), m_chunkSlots(), m_width(0), m_height(0), m_chunksWide(0), m_isBuilt(false) {}
+
+		void Build(TileMapView<TileStorage>);
+
+		/// <summary> Forgets every cell, so that the index ignores changes until it is built again. </summary>
+		/// <remarks> Keeps the memory, so that building again does not allocate. </remarks>
+		inline void		Invalidate()							{ m_isBuilt = false; }
+
+		/// <summary> Finds if the index has been built since it was last invalidated. </summary>
+		/// <returns> <c>true</c> if the index is up to date; otherwise, <c>false</c>. </returns>
+		inline bool		IsBuilt()						const	{ return m_isBuilt; }
+
+		void			SetCell(Point, bool);
+
+		/// <summary> Gets the amount of clear cells. </summary>
+		/// <returns> The amount of clear cells within the playable area. </returns>
+		inline uint32_t GetCount()						const	{ return (uint32_t)m_cells.size(); }
+
+		/// <summary> Gets the position of the clear cell in the given slot. </summary>
+		/// <param name="_slot"> The slot, from <c>0</c> to <see cref="GetCount"/>. </param>
+		/// <returns> The position of the cell. </returns>
+		inline Point	GetCell(const uint32_t _slot)	const	{ return Point((int32_t)(m_cells[_slot] % m_width), (int32_t)(m_cells[_slot] / m_width)); }
+	private:
+		/// <summary> The index of every clear cell, in no particular order. </summary>
+		std::vector<uint32_t>	m_cells;
+
+		/// <summary> The slot in <see cref="m_cells"/> of each cell of a chunk, in the same order as the planes of a <see cref="TileStorage"/> chunk, or <see cref="c_noSlot"/> if the cell is not clear. </summary>
+		typedef std::array<uint32_t, TileStorage::c_chunkSize * TileStorage::c_chunkSize> ChunkSlots;
+
+		/// <summary> The slots of every chunk in row-major order, where <c>NULL</c> chunks have never held a clear cell. </summary>
+		std::vector<std::unique_ptr<ChunkSlots>>	m_chunkSlots;
+
+		/// <summary> The width of the map. </summary>
+		uint32_t				m_width;
+
+		/// <summary> The height of the map. </summary>
+		uint32_t				m_height;
+
+		/// <summary> The amount of chunks along each row. </summary>
+		uint32_t				m_chunksWide;
+
+		/// <summary> Is <c>true</c> if the index is up to date; otherwise, <c>false</c>. </summary>
+		bool					m_isBuilt;
+
+		/// <summary> Finds the slot of the cell at the given index. </summary>
+		/// <param name="_cellIndex"> The index of the cell. </param>
+		/// <returns> The slot of the cell, or <see cref="c_noSlot"/> if it is not clear. </returns>
+		inline uint32_t			findSlot(const uint32_t _cellIndex) const
+		{
+			const ChunkSlots* slots = m_chunkSlots[getChunkIndex(_cellIndex)].get();
+			return (slots != NULL) ? (*slots)[getLocalIndex(_cellIndex)] : c_noSlot;
+		}
+
+		/// <summary> Gets the slot of the cell at the given index to write to, making the slots of its chunk if they do not yet exist. </summary>
+		/// <param name="_cellIndex"> The index of the cell. </param>
+		/// <returns> The slot of the cell. </returns>
+		inline uint32_t&		getOrCreateSlot(const uint32_t _cellIndex)
+		{
+			std::unique_ptr<ChunkSlots>& slots = m_chunkSlots[getChunkIndex(_cellIndex)];
+			if (slots == nullptr) { slots.reset(new ChunkSlots()); slots->fill(c_noSlot); }
+			return (*slots)[getLocalIndex(_cellIndex)];
+		}
+
+		/// <summary> Calculates the index into <see cref="m_chunkSlots"/> of the chunk that holds the cell at the given index. </summary>
+		/// <param name="_cellIndex"> The index of the cell. </param>
+		/// <returns> The index of the chunk. </returns>
+		inline uint32_t			getChunkIndex(const uint32_t _cellIndex) const	{ return ((_cellIndex / m_width) >> TileStorage::c_chunkShift) * m_chunksWide + ((_cellIndex % m_width) >> TileStorage::c_chunkShift); }
+
+		/// <summary> Calculates the index into the slots of its chunk of the cell at the given index. </summary>
+		/// <param name="_cellIndex"> The index of the cell. </param>
+		/// <returns> The index of the cell within its chunk. </returns>
+		inline uint32_t			getLocalIndex(const uint32_t _cellIndex) const	{ return (((_cellIndex / m_width) & TileStorage::c_chunkMask) << TileStorage::c_chunkShift) | ((_cellIndex % m_width) & TileStorage::c_chunkMask); }
+	};
+}
+#endif
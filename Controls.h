@@ -7,7 +7,7 @@
 namespace Controls
 {
 	/// <summary> Represents a command that the player can make. </summary>
-	enum Command { None = -1, MoveLeft, MoveUp, MoveRight, MoveDown, Interact, Swing };
+	enum Command { None = -1, MoveLeft, MoveUp, MoveRight, MoveDown, Interact, Swing, ToggleFrameTime, ToggleChunkCache };
 
 	/// <summary> Represents an input method. </summary>
 	class Controls
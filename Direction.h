@@ -93,8 +93,9 @@ struct Direction
 	}
 
 	/// <summary> Gets a random <see cref="Direction"/>. </summary>
+	/// <param name="_random"> The random stream to use. </param>
 	/// <returns> The random <see cref="Direction"/>. </returns>
-	inline static Direction GetRandom() { return Direction((Directions)Random::RandomBetween(0, 3)); }
+	inline static Direction GetRandom(Random::RandomStream& _random) { return Direction((Directions)_random.Between(0, 3)); }
 
 	/// <summary> Gets the <see cref="Direction"/> that is looking at the given position the most. </summary>
 	/// <param name="_position"> The position that is looking. </param>
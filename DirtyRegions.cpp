@@ -0,0 +1,74 @@
+#include "DirtyRegions.h"
+
+// Utility includes.
+#include <algorithm>
+
+/// <summary> Marks the given area as dirty, merging it with any touching areas. </summary>
+/// <param name="_area"> The area to mark. </param>
+void WorldObjects::DirtyRegions::MarkArea(const Rectangle _area)
+{
+	// Empty areas change nothing.
+	if (_area.w <= 0 || _area.h <= 0) { return; }
+
+	// Keep merging the area with any region worth merging with, removing the merged region, until no more merges can be made.
+	Rectangle merged = _area;
+	for (size_t i = 0; i < m_regions.size();)
+	{
+		if (isWorthMerging(m_regions[i], merged))
+		{
+			// Merge the two, then remove the old region by swapping it with the last and start again, as the larger area may now reach earlier regions.
+			merged = getBounds(m_regions[i], merged);
+			m_regions[i] = m_regions.back();
+			m_regions.pop_back();
+			i = 0;
+		}
+		else { i++; }
+	}
+
+	// If there are already too many regions, merge everything into one so that tracking stays cheap.
+	if (m_regions.size() >= c_maxRegions)
+	{
+		for (size_t i = 0; i < m_regions.size(); i++) { merged = getBounds(m_regions[i], merged); }
+		m_regions.clear();
+	}
+
+	m_regions.push_back(merged);
+}
+
+/// <summary> Takes every dirty area, leaving this empty. </summary>
+/// <returns> The dirty areas since the last consume. </returns>
+std::vector<Rectangle> WorldObjects::DirtyRegions::Consume()
+{
+	std::vector<Rectangle> regions;
+	regions.swap(m_regions);
+	return regions;
+}
+
+/// <summary> Calculates the smallest rectangle that covers both given rectangles. </summary>
+/// <param name="_first"> The first rectangle. </param>
+/// <param name="_second"> The second rectangle. </param>
+/// <returns> The bounding rectangle. </returns>
+Rectangle WorldObjects::DirtyRegions::getBounds(const Rectangle _first, const Rectangle _second)
+{
+	int32_t minX = std::min(_first.x, _second.x);
+	int32_t minY = std::min(_first.y, _second.y);
+	return Rectangle(minX, minY, std::max(_first.GetMaxX(), _second.GetMaxX()) - minX, std::max(_first.GetMaxY(), _second.GetMaxY()) - minY);
+}
+
+/// <summary> Finds if merging the given rectangles would mark few enough extra cells to be worth it. </summary>
+/// <param name="_first"> The first rectangle. </param>
+/// <param name="_second"> The second rectangle. </param>
+/// <returns> <c>true</c> if the rectangles overlap, or touch and their bounds are not much larger than both combined; otherwise, <c>false</c>. </returns>
+bool WorldObjects::DirtyRegions::isWorthMerging(const Rectangle _first, const Rectangle _second)
+{
+	// Overlapping rectangles must always be merged so that no cell is handed out twice.
+	if (_first.Intersects(_second)) { return true; }
+
+	// Rectangles that do not even touch are kept apart.
+	if (!Rectangle(_first.x - 1, _first.y - 1, _first.w + 2, _first.h + 2).Intersects(_second)) { return false; }
+
+	// Touching rectangles are merged if the bounds waste no more than half of their area.
+	Rectangle bounds = getBounds(_first, _second);
+	int64_t combinedArea = (int64_t)_first.w * _first.h + (int64_t)_second.w * _second.h;
+	return (int64_t)bounds.w * bounds.h * 2 <= combinedArea * 3;
+}
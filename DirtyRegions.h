@@ -0,0 +1,49 @@
+#ifndef DIRTYREGIONS_H
+#define DIRTYREGIONS_H
+
+// Data includes.
+#include "Point.h"
+#include "Rectangle.h"
+
+// Utility includes.
+#include <vector>
+
+// Typedef includes.
+#include <stdint.h>
+
+namespace WorldObjects
+{
+	/// <summary> Represents a set of areas that have changed since they were last consumed, kept as a small amount of coalesced rectangles. </summary>
+	class DirtyRegions
+	{
+	public:
+		/// <summary> The most rectangles held before every rectangle is merged into one. </summary>
+		static const uint32_t c_maxRegions = 16;
+
+		DirtyRegions() : m_regions() {}
+
+		/// <summary> Marks the given cell as dirty. </summary>
+		/// <param name="_position"> The position of the cell. </param>
+		inline void								MarkCell(const Point _position)			{ MarkArea(Rectangle(_position, Point(1, 1))); }
+
+		void									MarkArea(Rectangle);
+
+		/// <summary> Finds if no area is dirty. </summary>
+		/// <returns> <c>true</c> if nothing has changed since the last consume; otherwise, <c>false</c>. </returns>
+		inline bool								IsEmpty()						const	{ return m_regions.empty(); }
+
+		/// <summary> Gets the dirty areas. </summary>
+		/// <returns> The dirty areas, none of which overlap. </returns>
+		inline const std::vector<Rectangle>&	GetRegions()					const	{ return m_regions; }
+
+		std::vector<Rectangle>					Consume();
+	private:
+		/// <summary> The dirty areas. </summary>
+		std::vector<Rectangle> m_regions;
+
+		static Rectangle	getBounds(Rectangle, Rectangle);
+
+		static bool			isWorthMerging(Rectangle, Rectangle);
+	};
+}
+#endif
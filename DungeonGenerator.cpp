@@ -3,26 +3,34 @@
 // Data includes.
 #include "Rectangle.h"
 
+// Map generation includes.
+#include "GemSeeder.h"
+
 // Utility includes.
-#include "Random.h"
-#include <queue>
+#include <thread>
 
 /// <summary> Generates a dungeno on the given map and sets the given start and end positions. </summary>
 /// <param name="_map"> The map on which to generate. </param>
+/// <param name="_random"> The random stream to draw from. </param>
 /// <param name="_start"> The spawn point game object. </param>
 /// <param name="_end"> The exit point game object. </param>
-void MapGeneration::DungeonGenerator::Generate(WorldObjects::TileMap& _map, GameObjects::MapObject& _start, GameObjects::MapObject& _end)
+void MapGeneration::DungeonGenerator::Generate(WorldObjects::TileMap& _map, Random::RandomStream& _random, GameObjects::MapObject& _start, GameObjects::MapObject& _end)
 {
-	// Set the map reference to the given map and reset it.
+	// Set the map and random references to the given ones and reset the map.
 	m_map = &_map;
+	m_random = &_random;
 	m_map->Reset();
 
-	// These functions are pretty self-explanatory.
+	// These functions are pretty self-explanatory, stopping between each if the generation is cancelled.
 	placeRooms(c_roomAmount, _end);
+	if (isCancelled()) { return; }
 	generateMaze(_start);
+	if (isCancelled()) { return; }
 	breakWalls();
+	if (isCancelled()) { return; }
 	removeDeadEnds(_start.GetTilePosition());
-	generateGems();
+	if (isCancelled()) { return; }
+	GemSeeder::SeedGems(*m_map, *m_random, c_averageProsperityPerCell);
 }
 
 /// <summary> Places the given amount of rooms, and the given exit point in one of them. </summary>
@@ -37,25 +45,25 @@ void MapGeneration::DungeonGenerator::placeRooms(const uint8_t _numberOfRooms, G
 		for (int32_t attempt = 0; attempt < c_maxRoomAttempts; attempt++)
 		{
 			// Randomise the width and height of the room, ensuring they are odd.
-			int32_t width = Random::RandomBetween(c_minRoomWidth, c_maxRoomWidth);
-			int32_t height = Random::RandomBetween(c_minRoomHeight, c_maxRoomHeight);
+			int32_t width = m_random->Between(c_minRoomWidth, c_maxRoomWidth);
+			int32_t height = m_random->Between(c_minRoomHeight, c_maxRoomHeight);
 			if (width % 2 == 0)		{ width--; }
 			if (height % 2 == 0)	{ height--; }
 
 			// Randomises the position, ensuring there are at least 3 cells between the room and the sides of the map and are odd.
-			int32_t x = Random::RandomBetween(3, m_map->GetWidth() - width - 3);
-			int32_t y = Random::RandomBetween(3, m_map->GetHeight() - height - 3);
+			int32_t x = m_random->Between(3, m_map->GetWidth() - width - 3);
+			int32_t y = m_random->Between(3, m_map->GetHeight() - height - 3);
 			if (x % 2 == 0)			{ x--; }
 			if (y % 2 == 0)			{ y--; }
 			
 			// If the area is clear, create a room here.
-			if (m_map->AreaIsBlocked(Rectangle(x - 1, y - 1, width + 1, height + 1)))
+			if (m_map->GetView().AreaIsBlocked(Rectangle(x - 1, y - 1, width + 1, height + 1)))
 			{
 				// Fill the area with a floor.
-				m_map->FillAreaWithRandomFloor(Rectangle(x, y, width, height));
+				m_map->FillAreaWithRandomFloor(Rectangle(x, y, width, height), *m_random);
 
 				// If the exit point has not been set yet, set it to a random point within the room, away from any walls.
-				if (_end.GetTilePosition() == Point(0, 0)) { _end.SetTilePosition(Point(Random::RandomBetween(x + 1, x + width - 1), Random::RandomBetween(y + 1, y + height - 1))); }
+				if (_end.GetTilePosition() == Point(0, 0)) { _end.SetTilePosition(Point(m_random->Between(x + 1, x + width - 1), m_random->Between(y + 1, y + height - 1))); }
 
 				// Break out of the attempt loop.
 				break;
@@ -69,7 +77,7 @@ void MapGeneration::DungeonGenerator::placeRooms(const uint8_t _numberOfRooms, G
 void MapGeneration::DungeonGenerator::generateMaze(GameObjects::MapObject& _start)
 {
 	// Start at a random side of the map.
-	Direction startingDirection = Direction::GetRandom();
+	Direction startingDirection = Direction::GetRandom(*m_random);
 
 	// The position whence the maze starts.
 	int32_t spawnX, spawnY;
@@ -78,7 +86,7 @@ void MapGeneration::DungeonGenerator::generateMaze(GameObjects::MapObject& _star
 	if (startingDirection == Directions::Left || startingDirection == Directions::Right)
 	{
 		// Chooses a random Y position from which to start, and ensures it's odd.
-		spawnY = Random::RandomBetween(1, m_map->GetHeight() - 2);
+		spawnY = m_random->Between(1, m_map->GetHeight() - 2);
 		if (spawnY % 2 == 0) spawnY--;
 
 		// Sets the X of the spawn based the starting direction.
@@ -87,7 +95,7 @@ void MapGeneration::DungeonGenerator::generateMaze(GameObjects::MapObject& _star
 	else
 	{
 		// Chooses a random X position from which to start, and ensures it's odd.
-		spawnX = Random::RandomBetween(1, m_map->GetWidth() - 2);
+		spawnX = m_random->Between(1, m_map->GetWidth() - 2);
 		if (spawnX % 2 == 0) spawnX--;
 
 		// Sets the Y of the spawn based on the starting direction.
@@ -97,8 +105,132 @@ void MapGeneration::DungeonGenerator::generateMaze(GameObjects::MapObject& _star
 	// Set the spawn point.
 	_start.SetTilePosition(Point(spawnX, spawnY));
 
-	// Starts the recursive visit function from the spawn.
-	visitCell(Point(spawnX, spawnY) + startingDirection.GetOpposite().GetNormal(), startingDirection);
+	// Carve the maze from the cell inside the spawn, either all at once or split into regions.
+	Point mazeStart = Point(spawnX, spawnY) + startingDirection.GetOpposite().GetNormal();
+	if (m_mazeRegions > 1) { generateMazeInRegions(mazeStart, startingDirection); return; }
+
+	// Make room in the frontier for the deepest the maze could go, which is every cell it could carve.
+	m_frontier.reserve(((m_map->GetWidth() / 2) * (m_map->GetHeight() / 2)));
+
+	MapMazeTarget target = { m_map, m_random };
+	m_corridorAmount += carveMaze(target, *m_random, m_frontier, mazeStart, startingDirection);
+}
+
+/// <summary> Splits the map into bands of rows, carves a separate maze in each band on its own thread, then joins each band to the next. </summary>
+/// <param name="_start"> The first cell of the maze, inside the spawn. </param>
+/// <param name="_from"> The direction of the spawn from the first cell. </param>
+/// <remarks> Each band only reads the map and writes to its own mask, and the row between two bands is never carved by either, so the bands do not affect each other while carving. </remarks>
+void MapGeneration::DungeonGenerator::generateMazeInRegions(const Point _start, const Direction _from)
+{
+	// Split the rows of maze nodes, which are odd, as evenly as possible between the regions, keeping at least a few node rows in each.
+	int32_t nodeRows = (m_map->GetHeight() - 1) / 2;
+	int32_t regionAmount = std::max(1, std::min((int32_t)m_mazeRegions, nodeRows / 4));
+
+	// Create the target of each region, and seed a stream for each from the generation stream so that the result only depends on the seed.
+	std::vector<RegionMazeTarget> targets;
+	std::vector<Random::RandomStream> streams;
+	std::vector<Point> starts;
+	std::vector<Direction> froms;
+	for (int32_t i = 0; i < regionAmount; i++)
+	{
+		int32_t top = 1 + 2 * ((nodeRows * i) / regionAmount);
+		int32_t bottom = 2 * ((nodeRows * (i + 1)) / regionAmount) - 1;
+		Rectangle bounds(0, top, m_map->GetWidth(), bottom - top + 1);
+		targets.push_back({ m_map->GetView(), bounds, std::vector<uint8_t>((size_t)bounds.w * (bounds.h + 2), 0), 0 });
+		streams.push_back(Random::RandomStream(((uint64_t)m_random->Next() << 32) | m_random->Next()));
+
+		// The region holding the spawn starts from it, every other region starts from the first valid node found from a random one.
+		if (bounds.IsPointInside(_start)) { starts.push_back(_start); froms.push_back(_from); continue; }
+		int32_t columns = (bounds.w - 1) / 2;
+		int32_t rows = (bounds.h + 1) / 2;
+		int32_t offset = m_random->Between(0, columns * rows - 1);
+		Point start = Point(-1, -1);
+		for (int32_t n = 0; n < columns * rows; n++)
+		{
+			int32_t node = (offset + n) % (columns * rows);
+			Point position(1 + 2 * (node % columns), top + 2 * (node / columns));
+			if (targets.back().IsValidNode(position)) { start = position; break; }
+		}
+		starts.push_back(start);
+
+		// Enter from the side, so that the cell behind the start is always within the band.
+		froms.push_back(start.x > 1 ? Direction(Directions::Left) : Direction(Directions::Right));
+	}
+
+	// Carve every region at once, each with its own frontier.
+	std::vector<std::thread> threads;
+	for (int32_t i = 0; i < regionAmount; i++)
+	{
+		if (starts[i].x < 0) { continue; }
+		threads.push_back(std::thread([this, &targets, &streams, &starts, &froms, i]()
+		{
+			std::vector<MazeFrame> frontier;
+			frontier.reserve((targets[i].m_bounds.w / 2) * ((targets[i].m_bounds.h + 1) / 2));
+			targets[i].m_corridorAmount = carveMaze(targets[i], streams[i], frontier, starts[i], froms[i]);
+		}));
+	}
+	for (size_t i = 0; i < threads.size(); i++) { threads[i].join(); }
+
+	// Copy each mask onto the map in order, picking each floor from the generation stream.
+	for (int32_t i = 0; i < regionAmount; i++)
+	{
+		const RegionMazeTarget& target = targets[i];
+		for (int32_t y = target.m_bounds.y - 1; y <= target.m_bounds.GetMaxY(); y++)
+		{
+			for (int32_t x = 0; x < target.m_bounds.w; x++)
+			{
+				if (target.m_carved[target.getMaskIndex(Point(x, y))] != 0) { m_map->FillCell(Point(x, y), SpriteData::GetRandomFloor(*m_random)); }
+			}
+		}
+		m_corridorAmount += target.m_corridorAmount;
+	}
+
+	// Join each region to the next by opening a random cell of the row between them that has floor on both sides.
+	WorldObjects::TileMap::View view = m_map->GetView();
+	for (int32_t i = 1; i < regionAmount; i++)
+	{
+		int32_t row = targets[i].m_bounds.y - 1;
+		std::vector<Point> joins;
+		for (int32_t x = 1; x < (int32_t)view.GetWidth() - 1; x += 2)
+		{
+			if (view.IsCellClear(Point(x, row - 1)) && view.IsCellClear(Point(x, row + 1))) { joins.push_back(Point(x, row)); }
+		}
+
+		// If no cell of the row has floor on both sides, carve a longer corridor across it instead, so that the band is never cut off.
+		if (joins.empty()) { carveConnector(row, targets[i].m_bounds.GetMaxY()); continue; }
+
+		m_map->FillCell(joins[m_random->Between(0, (int32_t)joins.size() - 1)], SpriteData::GetRandomFloor(*m_random));
+		m_corridorAmount++;
+	}
+}
+
+/// <summary> Carves a straight corridor across the given row, from the closest floor above it to the closest floor below it within the band ending at the given row. </summary>
+/// <param name="_row"> The row between the two bands. </param>
+/// <param name="_bottom"> The last row of the band below, past which floor is not looked for. </param>
+/// <remarks> Floor above is looked for up to the top of the map, so a band left without any floor is crossed to reach the band above it. If the band below has no floor, there is nothing to join and nothing is carved. </remarks>
+void MapGeneration::DungeonGenerator::carveConnector(const int32_t _row, const int32_t _bottom)
+{
+	WorldObjects::TileMap::View view = m_map->GetView();
+
+	// Find the column where the floor on each side is closest together, only passing through walls to reach it.
+	int32_t bestX = -1, bestTop = 0, bestBottom = 0;
+	for (int32_t x = 1; x < (int32_t)view.GetWidth() - 1; x++)
+	{
+		int32_t top = _row - 1;
+		while (top > 0 && !view.IsCellClear(Point(x, top))) { top--; }
+		int32_t bottom = _row + 1;
+		while (bottom <= _bottom && !view.IsCellClear(Point(x, bottom))) { bottom++; }
+
+		if (top > 0 && bottom <= _bottom && (bestX < 0 || bottom - top < bestBottom - bestTop)) { bestX = x; bestTop = top; bestBottom = bottom; }
+	}
+	if (bestX < 0) { return; }
+
+	// Carve every wall between the two floors.
+	for (int32_t y = bestTop + 1; y < bestBottom; y++)
+	{
+		m_map->FillCell(Point(bestX, y), SpriteData::GetRandomFloor(*m_random));
+		m_corridorAmount++;
+	}
 }
 
 /// <summary> Removes a certain amount of dead ends from the map, excluding the spawn. </summary>
@@ -108,17 +240,20 @@ void MapGeneration::DungeonGenerator::removeDeadEnds(const Point _spawnPosition)
 	// Create a vector to store the positions of the dead ends.
 	std::vector<Point> deadEnds(0);
 
+	// Get a view of the map, which sees every change made through the map itself.
+	WorldObjects::TileMap::View view = m_map->GetView();
+
 	// Go over every cell and add every dead end to the vector.
-	for (int32_t x = 0; x < m_map->GetWidth(); x++)
+	for (int32_t x = 0; x < (int32_t)view.GetWidth(); x++)
 	{
-		for (int32_t y = 0; y < m_map->GetHeight(); y++)
+		for (int32_t y = 0; y < (int32_t)view.GetHeight(); y++)
 		{
-			if (isCellDeadEnd(Point(x, y), _spawnPosition)) { deadEnds.push_back(Point(x, y)); }
+			if (isCellDeadEnd(view, Point(x, y), _spawnPosition)) { deadEnds.push_back(Point(x, y)); }
 		}
 	}
 
 	// Shuffle the dead ends vector.
-	std::random_shuffle(deadEnds.begin(), deadEnds.end());
+	m_random->Shuffle(deadEnds);
 
 	// Calculate how many corridors must be left.
 	uint32_t corridorsToLeave = m_corridorAmount * c_percentageOfCorridorsToLeave;
@@ -131,14 +266,14 @@ void MapGeneration::DungeonGenerator::removeDeadEnds(const Point _spawnPosition)
 		deadEnds.pop_back();
 
 		// Sets this dead end to a wall and decrements the corridor count.
-		m_map->FillCell(deadEnd, SpriteData::GetRandomPlainWall());
+		m_map->FillCell(deadEnd, SpriteData::GetRandomPlainWall(*m_random));
 		m_corridorAmount--;
 		
 		// Check to see if the removal of this dead end created any more, and add them to the vector.
-		if (isCellDeadEnd(deadEnd + Direction(Directions::Left).GetNormal(),	_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Left).GetNormal());
-		if (isCellDeadEnd(deadEnd + Direction(Directions::Up).GetNormal(),		_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Up).GetNormal());
-		if (isCellDeadEnd(deadEnd + Direction(Directions::Right).GetNormal(),	_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Right).GetNormal());
-		if (isCellDeadEnd(deadEnd + Direction(Directions::Down).GetNormal(),	_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Down).GetNormal());
+		if (isCellDeadEnd(view, deadEnd + Direction(Directions::Left).GetNormal(),	_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Left).GetNormal());
+		if (isCellDeadEnd(view, deadEnd + Direction(Directions::Up).GetNormal(),		_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Up).GetNormal());
+		if (isCellDeadEnd(view, deadEnd + Direction(Directions::Right).GetNormal(),	_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Right).GetNormal());
+		if (isCellDeadEnd(view, deadEnd + Direction(Directions::Down).GetNormal(),	_spawnPosition)) deadEnds.push_back(deadEnd + Direction(Directions::Down).GetNormal());
 	}
 }
 
@@ -148,17 +283,20 @@ void MapGeneration::DungeonGenerator::breakWalls()
 	// Create a vector to store the breakable walls.
 	std::vector<Point> breakableWalls(0);
 
+	// Get a view of the map to query.
+	WorldObjects::TileMap::View view = m_map->GetView();
+
 	// Go over every cell, leaving a 1 thick border, and add every breakable wall to the vector.
-	for (int32_t x = 1; x < m_map->GetWidth() - 1; x++)
+	for (int32_t x = 1; x < (int32_t)view.GetWidth() - 1; x++)
 	{
-		for (int32_t y = 1; y < m_map->GetHeight() -1; y++)
+		for (int32_t y = 1; y < (int32_t)view.GetHeight() - 1; y++)
 		{
-			if (getAdjacentFloorCellsAmount(Point(x, y)) > 1) { breakableWalls.push_back(Point(x, y)); }
+			if (getAdjacentFloorCellsAmount(view, Point(x, y)) > 1) { breakableWalls.push_back(Point(x, y)); }
 		}
 	}
 
 	// Shuffle the breakable walls vector.
-	std::random_shuffle(breakableWalls.begin(), breakableWalls.end());
+	m_random->Shuffle(breakableWalls);
 
 	// Calculate how many walls to break.
 	int32_t wallsToBreak = breakableWalls.size() * c_percentageOfWallsToBreak;
@@ -172,106 +310,96 @@ void MapGeneration::DungeonGenerator::breakWalls()
 		breakableWalls.pop_back();
 
 		// Sets this wall to a floor and increases the broken walls count.
-		m_map->FillCell(breakableWall, SpriteData::GetRandomFloor());
+		m_map->FillCell(breakableWall, SpriteData::GetRandomFloor(*m_random));
 		brokenWalls++;
 	}
 }
 
-/// <summary> Fills the map with random gems. </summary>
-void MapGeneration::DungeonGenerator::generateGems()
+/// <summary> Carves a maze into the given target from the given cell, going as far as it can down each path before going back to the last cell with directions left to try. </summary>
+/// <param name="_target"> The target to carve into, which decides which cells are valid. </param>
+/// <param name="_random"> The random stream to roll the bends with. </param>
+/// <param name="_frontier"> The stack of carved cells with directions left to try, which is used instead of recursion so that any size of map can be carved. </param>
+/// <param name="_start"> The first cell to visit. </param>
+/// <param name="_from"> The direction whence the visit to the first cell came. </param>
+/// <returns> The amount of corridors carved. </returns>
+template <class T> uint32_t MapGeneration::DungeonGenerator::carveMaze(T& _target, Random::RandomStream& _random, std::vector<MazeFrame>& _frontier, Point _start, Direction _from) const
 {
-	// Set the remaining prosperity based on the area of the map and average prosperity per cell.
-	int32_t remainingProsperity = m_map->GetArea() * c_averageProsperityPerCell;
+	uint32_t corridorAmount = 0;
+	_frontier.clear();
 
-	// Repeat until the remaining prosperity is 0.
-	while (remainingProsperity > 0)
+	// Visit the given cell, then keep visiting the next direction of the newest cell on the frontier until none are left.
+	Point position = _start;
+	Direction from = _from;
+	while (true)
 	{
-		// Pick a random cell on the map.
-		Point randomCell = Point(Random::RandomBetween(1, m_map->GetWidth() - 2), Random::RandomBetween(1, m_map->GetHeight() - 2));
-
-		// If the cell has a wall, add some random prosperity to it.
-		if (m_map->IsCellBlockedAndInRange(randomCell)) 
+		// If this cell is valid, carve it and add it to the frontier.
+		if (_target.IsValidNode(position))
 		{
-			// Make sure the prosperity doesn't overflow.
-			int32_t prosperityToAdd = Random::RandomBetween(0, UCHAR_MAX - m_map->GetTileAt(randomCell).m_prosperity);
-
-			// Add the prosperity to the cell, then subtract that prosperity from the remaining prosperity.
-			m_map->SetCellProsperity(randomCell, prosperityToAdd);
-			remainingProsperity -= prosperityToAdd;
+			// Turn this cell and the cell behind it into a floor, making 2 corridors.
+			_target.Carve(position);
+			_target.Carve(position + from.GetNormal());
+			corridorAmount += 2;
+
+			// Get the direction facing forwards.
+			Direction to = from.GetOpposite();
+
+			// Roll to go left, right, or straight first.
+			float leftRoll = _random.Scalar();
+			float straightRoll = _random.Scalar();
+
+			// Pack the directions in the rolled order, straight going first if the roll was successful, otherwise last.
+			Direction first = (leftRoll > 50) ? to.GetLeft() : to.GetRight();
+			Direction second = (leftRoll > 50) ? to.GetRight() : to.GetLeft();
+			MazeFrame frame = { position, 0, 3 };
+			if (straightRoll > c_chanceToBend)	{ frame.m_directions = (uint8_t)(to.m_value | (first.m_value << 2) | (second.m_value << 4)); }
+			else								{ frame.m_directions = (uint8_t)(first.m_value | (second.m_value << 2) | (to.m_value << 4)); }
+			_frontier.push_back(frame);
 		}
-	}
-}
-
-/// <summary> Visits the given cell from the given direction in order to carve it out as a cave corridor. </summary>
-/// <param name="_position"> The position to visit. </param>
-/// <param name="_from"> The direction whence the visit came. </param>
-void MapGeneration::DungeonGenerator::visitCell(const Point _position, const Direction _from)
-{
-	// If this cell is invalid, return straight away.
-	if (!isCellValidMazeNode(_position)) { return; }
-
-	// Turn this cell and the cell behind it into a floor.
-	m_map->FillCell(_position, SpriteData::GetRandomFloor());
-	m_map->FillCell(_position + _from.GetNormal(), SpriteData::GetRandomFloor());
-
-	// 2 corridors were made, so increase the count by 2.
-	m_corridorAmount += 2;
-
-	// Create a queue to hold the next possible moves.
-	std::queue<Direction> possibleDirections = std::queue<Direction>();
 
-	// Get the direction facing forwards.
-	Direction to = _from.GetOpposite();
-
-	// Roll to go left, right, or straight first.
-	float leftRoll = Random::RandomScalar();
-	float straightRoll = Random::RandomScalar();
-
-	// If the straight roll was successful, add it first.
-	if (straightRoll > c_chanceToBend) { possibleDirections.push(to); }
-
-	// Add the left and right based on the roll.
-	possibleDirections.push(((leftRoll > 50) ? to.GetLeft() : to.GetRight()));
-	possibleDirections.push(((leftRoll > 50) ? to.GetRight() : to.GetLeft()));
-
-	// If the straight roll was unsuccessful, add it last.
-	if (straightRoll <= c_chanceToBend) { possibleDirections.push(to); }
-
-	// Visit each cell in the rolled order.
-	while (!possibleDirections.empty())
-	{
-		// Visit the cell then pop it off the queue.
-		visitCell(_position + possibleDirections.front().GetNormal() * 2, possibleDirections.front().GetOpposite());
-		possibleDirections.pop();
+		// Drop every cell that has no directions left, stopping once the whole maze has been visited.
+		while (!_frontier.empty() && _frontier.back().m_remainingDirections == 0) { _frontier.pop_back(); }
+		if (_frontier.empty()) { break; }
+
+		// Take the next direction of the newest cell and visit the cell two along it.
+		MazeFrame& current = _frontier.back();
+		Direction next = Direction((Directions)(current.m_directions & 3));
+		current.m_directions >>= 2;
+		current.m_remainingDirections--;
+		position = current.m_position + next.GetNormal() * 2;
+		from = next.GetOpposite();
 	}
+
+	return corridorAmount;
 }
 
 /// <summary> Finds if the given position is valid for the maze. </summary>
+/// <param name="_view"> The view of the map to check. </param>
 /// <param name="_position"> The position to check. </param>
 /// <returns> <c>true</c> if the maze can use this cell; otherwise, <c>false</c>. </returns>
-bool MapGeneration::DungeonGenerator::isCellValidMazeNode(const Point _position)
+bool MapGeneration::DungeonGenerator::isCellValidMazeNode(const WorldObjects::TileMap::View& _view, const Point _position)
 {
 	// If the cell is out of range, it is invalid, so return false.
-	if (!m_map->IsCellInRange(_position)) { return false; }
+	if (!_view.IsCellInRange(_position)) { return false; }
 
 	// If any of the adjacent cells are clear, this cell is invalid, so return false; otherwise return true.
-	return	!(m_map->IsCellClearAndInRange(_position + Direction(Directions::Left).GetNormal()) || m_map->IsCellClearAndInRange(_position + Direction(Directions::Right).GetNormal())
-			|| m_map->IsCellClearAndInRange(_position + Direction(Directions::Down).GetNormal()) || m_map->IsCellClearAndInRange(_position + Direction(Directions::Up).GetNormal()));
+	return	!(_view.IsCellClearAndInRange(_position + Direction(Directions::Left).GetNormal()) || _view.IsCellClearAndInRange(_position + Direction(Directions::Right).GetNormal())
+			|| _view.IsCellClearAndInRange(_position + Direction(Directions::Down).GetNormal()) || _view.IsCellClearAndInRange(_position + Direction(Directions::Up).GetNormal()));
 }
 
 /// <summary> Gets the amount of floors adjacent to the given position. </summary>
+/// <param name="_view"> The view of the map to check. </param>
 /// <param name="_position"> The position to check. </param>
 /// <returns> The number of adjacent floors to the given position. </returns>
-int32_t MapGeneration::DungeonGenerator::getAdjacentFloorCellsAmount(const Point _position)
+int32_t MapGeneration::DungeonGenerator::getAdjacentFloorCellsAmount(const WorldObjects::TileMap::View& _view, const Point _position)
 {
 	// Keep track of the amount of empty sides.
 	uint8_t emptySideAmount = 0;
 
 	// For each empty side, increase the counter by 1.
-	if (m_map->IsCellClearAndInRange(_position + Direction(Directions::Left).GetNormal()))	{ emptySideAmount++; }
-	if (m_map->IsCellClearAndInRange(_position + Direction(Directions::Up).GetNormal()))		{ emptySideAmount++; }
-	if (m_map->IsCellClearAndInRange(_position + Direction(Directions::Right).GetNormal()))	{ emptySideAmount++; }
-	if (m_map->IsCellClearAndInRange(_position + Direction(Directions::Down).GetNormal()))	{ emptySideAmount++; }
+	if (_view.IsCellClearAndInRange(_position + Direction(Directions::Left).GetNormal()))	{ emptySideAmount++; }
+	if (_view.IsCellClearAndInRange(_position + Direction(Directions::Up).GetNormal()))		{ emptySideAmount++; }
+	if (_view.IsCellClearAndInRange(_position + Direction(Directions::Right).GetNormal()))	{ emptySideAmount++; }
+	if (_view.IsCellClearAndInRange(_position + Direction(Directions::Down).GetNormal()))	{ emptySideAmount++; }
 
 	// return the amount of empty sides.
 	return emptySideAmount;
@@ -6,18 +6,96 @@
 
 // Data includes.
 #include "Point.h"
+#include "Rectangle.h"
 #include "Direction.h"
 
+// Utility includes.
+#include <algorithm>
+#include <vector>
+
 namespace MapGeneration
 {
 	/// <summary> Represents a map generator for a dungeon with lots of interconnected rooms. </summary>
 	class DungeonGenerator : public MapGeneration::MapGenerator
 	{
 	public:
-		DungeonGenerator() : m_map(NULL) {}
+		/// <summary> Creates a new dungeon generator that carves the maze in the given amount of regions at once. </summary>
+		/// <param name="_mazeRegions"> The amount of bands the maze is split into and carved on separate threads, <c>1</c> carves the whole maze on this thread. </param>
+		DungeonGenerator(const uint8_t _mazeRegions = 1) : m_map(NULL), m_random(NULL), m_mazeRegions(std::max(_mazeRegions, (uint8_t)1)), m_frontier() {}
 
-		virtual void Generate(WorldObjects::TileMap&, GameObjects::MapObject&, GameObjects::MapObject&);
+		virtual void Generate(WorldObjects::TileMap&, Random::RandomStream&, GameObjects::MapObject&, GameObjects::MapObject&);
 	private:
+		/// <summary> Represents a maze cell that has been carved and still has directions left to visit. </summary>
+		struct MazeFrame
+		{
+			/// <summary> The position of the cell. </summary>
+			Point	m_position;
+
+			/// <summary> The directions left to visit in order, two bits each starting from the lowest. </summary>
+			uint8_t	m_directions;
+
+			/// <summary> The amount of directions left to visit. </summary>
+			uint8_t	m_remainingDirections;
+		};
+
+		/// <summary> Represents a maze that is carved straight into the map. </summary>
+		struct MapMazeTarget
+		{
+			/// <summary> The map to carve. </summary>
+			WorldObjects::TileMap*	m_map;
+
+			/// <summary> The random stream used to pick each floor. </summary>
+			Random::RandomStream*	m_random;
+
+			/// <summary> Finds if the maze can use the given cell. </summary>
+			/// <param name="_position"> The position to check. </param>
+			/// <returns> <c>true</c> if the maze can use this cell; otherwise, <c>false</c>. </returns>
+			inline bool IsValidNode(const Point _position) const { return isCellValidMazeNode(m_map->GetView(), _position); }
+
+			/// <summary> Turns the given cell into a random floor. </summary>
+			/// <param name="_position"> The position to carve. </param>
+			inline void Carve(const Point _position) { m_map->FillCell(_position, SpriteData::GetRandomFloor(*m_random)); }
+		};
+
+		/// <summary> Represents a maze that is carved into its own mask within a band of the map, so that many can be carved at once without touching the map. </summary>
+		/// <remarks> The mask covers one extra row above and below the band, so that the entrance of the maze can be carved on the edge of the map. </remarks>
+		struct RegionMazeTarget
+		{
+			/// <summary> The view of the map, which is only read while carving. </summary>
+			WorldObjects::TileMap::View	m_view;
+
+			/// <summary> The area whose cells can be maze nodes. </summary>
+			Rectangle					m_bounds;
+
+			/// <summary> Whether each cell within the band and its extra rows has been carved. </summary>
+			std::vector<uint8_t>		m_carved;
+
+			/// <summary> The amount of corridors carved. </summary>
+			uint32_t					m_corridorAmount;
+
+			/// <summary> Finds if the given cell is clear, either on the map or within the mask. </summary>
+			/// <param name="_position"> The position to check. </param>
+			/// <returns> <c>true</c> if the cell is clear; otherwise, <c>false</c>. </returns>
+			inline bool IsClear(const Point _position) const { return m_view.IsCellClearAndInRange(_position) || (m_view.IsCellInRange(_position) && _position.y >= m_bounds.y - 1 && _position.y <= m_bounds.GetMaxY() && m_carved[getMaskIndex(_position)] != 0); }
+
+			/// <summary> Finds if the maze can use the given cell, in the same way as <see cref="isCellValidMazeNode"/>. </summary>
+			/// <param name="_position"> The position to check. </param>
+			/// <returns> <c>true</c> if the maze can use this cell; otherwise, <c>false</c>. </returns>
+			inline bool IsValidNode(const Point _position) const
+			{
+				return m_bounds.IsPointInside(_position) && !(IsClear(Point(_position.x - 1, _position.y)) || IsClear(Point(_position.x + 1, _position.y)) || IsClear(Point(_position.x, _position.y + 1)) || IsClear(Point(_position.x, _position.y - 1)));
+			}
+
+			/// <summary> Marks the given cell as carved. </summary>
+			/// <param name="_position"> The position to carve. </param>
+			inline void Carve(const Point _position) { m_carved[getMaskIndex(_position)] = 1; }
+
+			/// <summary> Gets the index into <see cref="m_carved"/> of the given position. </summary>
+			/// <param name="_position"> The position. </param>
+			/// <returns> The index. </returns>
+			inline size_t getMaskIndex(const Point _position) const { return (size_t)(_position.y - (m_bounds.y - 1)) * m_bounds.w + (_position.x - m_bounds.x); }
+		};
+
 		/// <summary> The amount of rooms to attempt to place. </summary>
 		const uint8_t			c_roomAmount = 20;
 
@@ -54,31 +132,43 @@ namespace MapGeneration
 
 		/// <summary> The tile data that this generator modifies. </summary>
 		WorldObjects::TileMap*	m_map;
+
+		/// <summary> The random stream that this generator draws from. </summary>
+		Random::RandomStream*	m_random;
 		
 		/// <summary> The amount of corridors on the map. </summary>
 		uint32_t				m_corridorAmount = 0;
 
+		/// <summary> The amount of bands the maze is split into and carved at once. </summary>
+		uint8_t					m_mazeRegions;
+
+		/// <summary> The cells waiting to have their remaining directions visited, kept between mazes so that its memory is reused. </summary>
+		std::vector<MazeFrame>	m_frontier;
+
 		void	placeRooms(uint8_t, GameObjects::MapObject&);
 
 		void	generateMaze(GameObjects::MapObject&);
 
+		void	generateMazeInRegions(Point, Direction);
+
+		void	carveConnector(int32_t, int32_t);
+
 		void	removeDeadEnds(Point);
 
 		void	breakWalls();
 
-		void	generateGems();
-
-		void	visitCell(Point, Direction);
+		template <class T> uint32_t carveMaze(T&, Random::RandomStream&, std::vector<MazeFrame>&, Point, Direction) const;
 
-		bool	isCellValidMazeNode(Point);
+		static bool		isCellValidMazeNode(const WorldObjects::TileMap::View&, Point);
 
-		int32_t	getAdjacentFloorCellsAmount(Point);
+		static int32_t	getAdjacentFloorCellsAmount(const WorldObjects::TileMap::View&, Point);
 
 		/// <summary> Checks to see if the cell at the given position has only one directly adjacent open cell. </summary>
+		/// <param name="_view"> The view of the map to check. </param>
 		/// <param name="_position"> The position to check. </param>
 		/// <param name="_spawn"> The tile position of the spawn. </param>
 		/// <returns> <c>true</c> if the cell at the given position has exactly 1 empty side; otherwise, <c>false</c>. </returns>
-		bool	isCellDeadEnd(const Point _position, const Point _spawnPosition) { return m_map->IsCellClearAndInRange(_position) && getAdjacentFloorCellsAmount(_position) == 1 && _position != _spawnPosition; }
+		static bool		isCellDeadEnd(const WorldObjects::TileMap::View& _view, const Point _position, const Point _spawnPosition) { return _view.IsCellClearAndInRange(_position) && getAdjacentFloorCellsAmount(_view, _position) == 1 && _position != _spawnPosition; }
 	};
 }
 #endif
\ No newline at end of file
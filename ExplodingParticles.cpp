@@ -2,46 +2,36 @@
 
 // Utility includes.
 #include <SDL_stdinc.h>
-
-/// <summary> Deletes the stored particles. </summary>
-Particles::ExplodingParticles::~ExplodingParticles()
-{
-	// Delete all active particles.
-	std::vector<Particle*>::iterator activeIterator = m_activeParticles.begin();
-	while (activeIterator != m_activeParticles.end())
-	{
-		delete *activeIterator;
-		activeIterator = m_activeParticles.erase(activeIterator);
-	}
-
-	// Delete all dead particles.
-	std::vector<Particle*>::iterator deadIterator = m_deadParticles.begin();
-	while (deadIterator != m_deadParticles.end())
-	{
-		delete *deadIterator;
-		deadIterator = m_deadParticles.erase(deadIterator);
-	}
-}
+#include <algorithm>
 
 /// <summary> Updates the particles based on the time that has passed. </summary>
 /// <param name="_gameTime"> The current gametime. </param>
 void Particles::ExplodingParticles::Update(Time::DeltaTime& _gameTime)
 {
-	// Update each particle, if any are below 0 scale after updating, move them to the pool.
-	std::vector<Particle*>::iterator activeIterator = m_activeParticles.begin();
-	while (activeIterator != m_activeParticles.end())
+	// Get the delta time once, along with plain pointers to each array so that the compiler can vectorise the loop.
+	const float_t deltaTime = (float_t)_gameTime.GetDeltaTimeS();
+	const size_t amount = m_scales.size();
+	float_t* positionsX = m_positionsX.data();
+	float_t* positionsY = m_positionsY.data();
+	const float_t* directionsX = m_directionsX.data();
+	const float_t* directionsY = m_directionsY.data();
+	const float_t* speeds = m_speeds.data();
+	float_t* rotations = m_rotations.data();
+	const float_t* rotationSpeeds = m_rotationSpeeds.data();
+	float_t* scales = m_scales.data();
+	const float_t* scaleSpeeds = m_scaleSpeeds.data();
+
+	// Move, rotate, and shrink every particle, without any branches.
+	for (size_t i = 0; i < amount; i++)
 	{
-		// Updates the particle.
-		(*activeIterator)->Update(_gameTime);
-
-		// If the scale is at or lower than 0, move it to the dead pool.
-		if ((*activeIterator)->m_scale <= 0.0f)
-		{
-			m_deadParticles.push_back(*activeIterator);
-			activeIterator = m_activeParticles.erase(activeIterator);
-		}
-		else { activeIterator++; }
+		positionsX[i] += directionsX[i] * speeds[i] * deltaTime;
+		positionsY[i] += directionsY[i] * speeds[i] * deltaTime;
+		rotations[i] += rotationSpeeds[i] * deltaTime;
+		scales[i] -= scaleSpeeds[i] * deltaTime;
 	}
+
+	// Remove every particle at or below 0 scale, going backwards so that each particle swapped into a removed place has already been checked.
+	for (size_t i = amount; i > 0; i--) { if (m_scales[i - 1] <= 0.0f) { removeAt(i - 1); } }
 }
 
 /// <summary> Draws all currently active particles. </summary>
@@ -50,20 +40,31 @@ void Particles::ExplodingParticles::Update(Time::DeltaTime& _gameTime)
 /// <param name="_offset"> The offset from which to draw the particles, defaults to <c>0</c>, <c>0</c>. </param>
 void Particles::ExplodingParticles::Draw(Graphics::Graphics& _graphics, Screens::Screen& _screen, const Point _offset)
 {
-	// Draw each active particle.
-	for (uint16_t i = 0; i < m_activeParticles.size(); i++) { m_activeParticles[i]->Draw(m_sheetID, _graphics, _screen, _offset); }
+	// Draw each active particle, batched together as they all come from the same sheet.
+	_graphics.BeginBatch();
+	for (size_t i = 0; i < m_scales.size(); i++)
+	{
+		// Calculate the window position and draw.
+		Point windowPosition = _screen.ScreenToWindowSpace(Point(m_positionsX[i], m_positionsY[i]) - _offset);
+		_graphics.Draw(m_sheetID, m_spriteIDs[i], windowPosition, m_scales[i] * _screen.GetScale(), m_rotations[i]);
+	}
+	_graphics.EndBatch();
 }
 
 /// <summary> Stops all currently living particles. </summary>
 void Particles::ExplodingParticles::KillAllAlive()
 {
-	// Take each particle from the alive list and add them to the dead list.
-	std::vector<Particle*>::iterator activeIterator = m_activeParticles.begin();
-	while (activeIterator != m_activeParticles.end())
-	{
-		m_deadParticles.push_back(*activeIterator);
-		activeIterator = m_activeParticles.erase(activeIterator);
-	}
+	// Empty every array, which keeps their memory for the next particles.
+	m_spriteIDs.clear();
+	m_positionsX.clear();
+	m_positionsY.clear();
+	m_directionsX.clear();
+	m_directionsY.clear();
+	m_speeds.clear();
+	m_rotations.clear();
+	m_rotationSpeeds.clear();
+	m_scales.clear();
+	m_scaleSpeeds.clear();
 }
 
 /// <summary> Creates the given amount of particles at the given position, using the given start and end indices for sprite selection. </summary>
@@ -73,39 +74,94 @@ void Particles::ExplodingParticles::KillAllAlive()
 /// <param name="_endSpriteIndex"> The maximum value for the sprite index. </param>
 void Particles::ExplodingParticles::AddParticles(const Point _position, const uint16_t _amount, const uint16_t _startSpriteIndex, const uint16_t _endSpriteIndex)
 {
-	// Repeat for the given amount.
-	for (uint16_t i = 0; i < _amount; i++)
+	// If there are no particles to add, do nothing.
+	if (_amount == 0) { return; }
+
+	// Add the particles, then move them all to the position.
+	size_t firstIndex = addParticles(_amount, _startSpriteIndex, _endSpriteIndex);
+	std::fill(m_positionsX.begin() + firstIndex, m_positionsX.end(), (float_t)_position.x);
+	std::fill(m_positionsY.begin() + firstIndex, m_positionsY.end(), (float_t)_position.y);
+}
+
+/// <summary> Creates the given amount of particles at each of the given positions all at once, using the given start and end indices for sprite selection. </summary>
+/// <param name="_positions"> The positions at which the particles will start. </param>
+/// <param name="_amount"> The amount of particles to add at each position. </param>
+/// <param name="_startSpriteIndex"> The minimum value for the sprite index. </param>
+/// <param name="_endSpriteIndex"> The maximum value for the sprite index. </param>
+void Particles::ExplodingParticles::AddParticles(const std::vector<Point>& _positions, const uint16_t _amount, const uint16_t _startSpriteIndex, const uint16_t _endSpriteIndex)
+{
+	// If there are no particles to add, do nothing.
+	if (_amount == 0 || _positions.empty()) { return; }
+
+	// Add the particles for every position together, then move each run of particles to its position.
+	size_t firstIndex = addParticles(_positions.size() * _amount, _startSpriteIndex, _endSpriteIndex);
+	for (size_t i = 0; i < _positions.size(); i++)
 	{
-		// If there is a particle waiting in the pool, take that, otherwise create it.
-		Particle* particle;
-		if (m_deadParticles.size() > 0)
-		{
-			particle = m_deadParticles.back();
-			m_deadParticles.pop_back();
-		}
-		else { particle = new Particle(); }
-
-		// Create the particle and set its position and scale.
-		particle->m_position = Vector2(_position.x, _position.y);
- 		particle->m_scale = 1.0f;
-		
-		// Randomise its sprite ID.
-		particle->m_spriteID = Random::RandomBetween(_startSpriteIndex, _endSpriteIndex);
+		size_t runStart = firstIndex + i * _amount;
+		std::fill(m_positionsX.begin() + runStart, m_positionsX.begin() + runStart + _amount, (float_t)_positions[i].x);
+		std::fill(m_positionsY.begin() + runStart, m_positionsY.begin() + runStart + _amount, (float_t)_positions[i].y);
+	}
+}
+
+/// <summary> Grows every array by the given amount of randomised particles, which are left for the caller to position. </summary>
+/// <param name="_amount"> The amount of particles to add. </param>
+/// <param name="_startSpriteIndex"> The minimum value for the sprite index. </param>
+/// <param name="_endSpriteIndex"> The maximum value for the sprite index. </param>
+/// <returns> The index of the first new particle. </returns>
+size_t Particles::ExplodingParticles::addParticles(const size_t _amount, const uint16_t _startSpriteIndex, const uint16_t _endSpriteIndex)
+{
+	// Grow every array by the given amount, with the new particles at the end.
+	size_t firstIndex = m_scales.size();
+	size_t newSize = firstIndex + _amount;
+	m_spriteIDs.resize(newSize);
+	m_positionsX.resize(newSize);
+	m_positionsY.resize(newSize);
+	m_directionsX.resize(newSize);
+	m_directionsY.resize(newSize);
+	m_speeds.resize(newSize);
+	m_rotations.resize(newSize);
+	m_rotationSpeeds.resize(newSize);
+	m_scales.resize(newSize, 1.0f);
+	m_scaleSpeeds.resize(newSize);
 
-		// Randomise its rotation.
-		particle->m_rotation = (M_PI * 2.0f) * Random::RandomScalar();
-		particle->m_rotationSpeed = ((M_PI * 2.0f) - M_PI) * Random::RandomScalar();
+	// Fill the random values of every new particle at once, straight into the arrays where they will be scaled.
+	m_random->FillScalar(&m_rotations[firstIndex], _amount);
+	m_random->FillScalar(&m_rotationSpeeds[firstIndex], _amount);
+	m_random->FillScalar(&m_speeds[firstIndex], _amount);
+	m_random->FillScalar(&m_scaleSpeeds[firstIndex], _amount);
 
-		// Randomise its speed.
-		particle->m_speed = Random::RandomBetween(64, 128);
+	// Scale each random value into its range.
+	for (size_t i = firstIndex; i < newSize; i++)
+	{
+		// Randomise its sprite ID.
+		m_spriteIDs[i] = (uint16_t)m_random->Between(_startSpriteIndex, _endSpriteIndex);
 
-		// Randomise its shrink speed.
-		particle->m_scaleSpeed = (Random::RandomScalar() / 4.0f) + 0.75f;
+		// Randomise its rotation, speed, and shrink speed.
+		m_rotations[i] *= (float_t)(M_PI * 2.0f);
+		m_rotationSpeeds[i] *= (float_t)((M_PI * 2.0f) - M_PI);
+		m_speeds[i] = 64.0f + (m_speeds[i] * 64.0f);
+		m_scaleSpeeds[i] = (m_scaleSpeeds[i] / 4.0f) + 0.75f;
 
 		// Set its direction.
-		particle->m_direction = Vector2::fromRadians(particle->m_rotation);
-
-		// Add it to the active particles.
-		m_activeParticles.push_back(particle);
+		m_directionsX[i] = cos(m_rotations[i]);
+		m_directionsY[i] = sin(m_rotations[i]);
 	}
+
+	return firstIndex;
+}
+
+/// <summary> Removes the particle at the given index by replacing it with the last particle. </summary>
+/// <param name="_index"> The index of the particle. </param>
+void Particles::ExplodingParticles::removeAt(const size_t _index)
+{
+	swapAndPop(m_spriteIDs, _index);
+	swapAndPop(m_positionsX, _index);
+	swapAndPop(m_positionsY, _index);
+	swapAndPop(m_directionsX, _index);
+	swapAndPop(m_directionsY, _index);
+	swapAndPop(m_speeds, _index);
+	swapAndPop(m_rotations, _index);
+	swapAndPop(m_rotationSpeeds, _index);
+	swapAndPop(m_scales, _index);
+	swapAndPop(m_scaleSpeeds, _index);
 }
@@ -10,21 +10,23 @@
 #include "Time.h"
 
 // Data includes.
-#include "Particle.h"
 #include "Point.h"
 
 // Utility includes.
 #include <vector>
 
+// Typedef includes.
+#include <cmath>
+#include <stdint.h>
+
 namespace Particles
 {
 	/// <summary> Represents a particle manager where the particles explode outwards from their starting point. </summary>
+	/// <remarks> Each property of the particles is held in its own array, where the same index across every array is one particle. Dead particles are swapped with the last, so the arrays never have gaps and keep their memory to be reused. </remarks>
 	class ExplodingParticles : public ParticleManager
 	{
 	public:
-		~ExplodingParticles();
-
-		ExplodingParticles() : m_activeParticles(std::vector<Particle*>()), m_deadParticles(std::vector<Particle*>()) { }
+		ExplodingParticles() : m_random(NULL), m_spriteIDs(), m_positionsX(), m_positionsY(), m_directionsX(), m_directionsY(), m_speeds(), m_rotations(), m_rotationSpeeds(), m_scales(), m_scaleSpeeds() { }
 
 		void Update(Time::DeltaTime&);
 
@@ -32,20 +34,67 @@ namespace Particles
 
 		void KillAllAlive();
 
+		/// <summary> Gets the amount of currently active particles. </summary>
+		/// <returns> The amount of active particles. </returns>
+		inline size_t GetActiveAmount() const { return m_scales.size(); }
+
 		/// <summary> Sets the sheet ID to be used. </summary>
 		/// <param name="_sheetID"> The sheet ID. </param>
 		inline void SetSheetID(const uint16_t _sheetID) { m_sheetID = _sheetID; }
 
+		/// <summary> Sets the random stream that new particles are randomised with. </summary>
+		/// <param name="_random"> The random stream. </param>
+		inline void SetRandomStream(Random::RandomStream& _random) { m_random = &_random; }
+
 		virtual void AddParticles(Point, uint16_t, uint16_t, uint16_t);
+
+		virtual void AddParticles(const std::vector<Point>&, uint16_t, uint16_t, uint16_t);
 	private:
 		/// <summary> The ID of the sheet where the particles are stored. </summary>
 		uint16_t m_sheetID;
 
-		/// <summary> The currently active particles. </summary>
-		std::vector<Particle*> m_activeParticles;
+		/// <summary> The random stream that new particles are randomised with. </summary>
+		Random::RandomStream* m_random;
+
+		/// <summary> The ID for the sprite of each particle. </summary>
+		std::vector<uint16_t>	m_spriteIDs;
+
+		/// <summary> The current x position of each particle. </summary>
+		std::vector<float_t>	m_positionsX;
+
+		/// <summary> The current y position of each particle. </summary>
+		std::vector<float_t>	m_positionsY;
+
+		/// <summary> The x direction of movement of each particle. </summary>
+		std::vector<float_t>	m_directionsX;
+
+		/// <summary> The y direction of movement of each particle. </summary>
+		std::vector<float_t>	m_directionsY;
+
+		/// <summary> The speed per second in pixels of each particle. </summary>
+		std::vector<float_t>	m_speeds;
+
+		/// <summary> The rotation in radians of each particle. </summary>
+		std::vector<float_t>	m_rotations;
+
+		/// <summary> The radians applied to the rotation of each particle every second. </summary>
+		std::vector<float_t>	m_rotationSpeeds;
+
+		/// <summary> A value from <c>1</c> to <c>0</c> of how large each particle is. </summary>
+		std::vector<float_t>	m_scales;
+
+		/// <summary> How much scale each particle loses per second. </summary>
+		std::vector<float_t>	m_scaleSpeeds;
+
+		size_t addParticles(size_t, uint16_t, uint16_t);
+
+		void removeAt(size_t);
 
-		/// <summary> The pool of available particles. </summary>
-		std::vector<Particle*> m_deadParticles;
+		/// <summary> Replaces the value at the given index of the given array with the last value, then removes the last value. </summary>
+		/// <param name="_values"> The array. </param>
+		/// <param name="_index"> The index to remove. </param>
+		template <typename T>
+		static inline void swapAndPop(std::vector<T>& _values, const size_t _index) { _values[_index] = _values.back(); _values.pop_back(); }
 	};
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,87 @@
+#include "FieldOfView.h"
+
+/// <summary> Uncovers every cell that can be seen within the 90 degree cone in front of the given position. </summary>
+/// <param name="_map"> The map on which to uncover cells. </param>
+/// <param name="_origin"> The position from which to look. </param>
+/// <param name="_facing"> The direction in which to look. </param>
+/// <param name="_radius"> How many rows away from the origin can be seen. </param>
+void WorldObjects::FieldOfView::UncoverCone(TileMap& _map, const Point _origin, const Direction _facing, const uint16_t _radius)
+{
+	// The origin can always be seen.
+	_map.SetCellVisiblity(_origin, true);
+
+	// Cast the octants on either side of the facing direction.
+	TileMap::View view = _map.GetView();
+	castOctant(_map, view, _origin, _facing.GetNormal(), _facing.GetLeft().GetNormal(), _radius, 1, 1.0f, 0.0f);
+	castOctant(_map, view, _origin, _facing.GetNormal(), _facing.GetRight().GetNormal(), _radius, 1, 1.0f, 0.0f);
+}
+
+/// <summary> Uncovers every cell that can be seen in any direction from the given position. </summary>
+/// <param name="_map"> The map on which to uncover cells. </param>
+/// <param name="_origin"> The position from which to look. </param>
+/// <param name="_radius"> How many rows away from the origin can be seen. </param>
+void WorldObjects::FieldOfView::UncoverAll(TileMap& _map, const Point _origin, const uint16_t _radius)
+{
+	// Cast the cone of each direction, which together cover every octant.
+	for (uint8_t i = Directions::Left; i <= Directions::Down; i++) { UncoverCone(_map, _origin, Direction((Directions)i), _radius); }
+}
+
+/// <summary> Uncovers the visible cells of a single octant, starting from the given row and between the given slopes. </summary>
+/// <param name="_map"> The map on which to uncover cells. </param>
+/// <param name="_view"> The view of the map, used to check which cells block vision. </param>
+/// <param name="_origin"> The position from which to look. </param>
+/// <param name="_forward"> The normal pointing away from the origin along each row. </param>
+/// <param name="_side"> The normal pointing along each row towards the edge of the octant. </param>
+/// <param name="_radius"> How many rows away from the origin can be seen. </param>
+/// <param name="_row"> The row to start from. </param>
+/// <param name="_outerSlope"> The slope of the outer edge of the visible area, where <c>1</c> is the diagonal. </param>
+/// <param name="_innerSlope"> The slope of the inner edge of the visible area, where <c>0</c> is straight ahead. </param>
+/// <remarks> Recurses once for every wall that splits the visible area, so the depth is at most the radius. </remarks>
+void WorldObjects::FieldOfView::castOctant(TileMap& _map, const TileMap::View _view, const Point _origin, const Point _forward, const Point _side, const uint16_t _radius, uint16_t _row, float_t _outerSlope, const float_t _innerSlope)
+{
+	// If the visible area has closed, nothing more can be seen.
+	if (_outerSlope < _innerSlope) { return; }
+
+	for (; _row <= _radius; _row++)
+	{
+		// Go along the row from the outer edge to the inner edge, keeping track of whether the last cell blocked vision.
+		bool isBlocked = false;
+		float_t nextOuterSlope = _outerSlope;
+		for (int32_t column = _row; column >= 0; column--)
+		{
+			// Calculate the slopes of the outer and inner corners of the cell.
+			float_t cellOuterSlope = (column + 0.5f) / (_row - 0.5f);
+			float_t cellInnerSlope = (column - 0.5f) / (_row + 0.5f);
+
+			// Skip cells outside of the visible area, and stop once past it.
+			if (cellInnerSlope > _outerSlope) { continue; }
+			if (cellOuterSlope < _innerSlope) { break; }
+
+			// Uncover the cell, walls included.
+			Point cell = _origin + (_forward * (int32_t)_row) + (_side * column);
+			_map.SetCellVisiblity(cell, true);
+			bool isCellBlocked = !_view.IsCellClearAndInRange(cell);
+
+			// If the last cell blocked vision, either keep narrowing past this wall or start a new visible area after it.
+			if (isBlocked)
+			{
+				if (isCellBlocked) { nextOuterSlope = cellInnerSlope; }
+				else
+				{
+					isBlocked = false;
+					_outerSlope = nextOuterSlope;
+				}
+			}
+			// Otherwise, if this cell starts a wall, scan the area before it on the next rows, then skip past it.
+			else if (isCellBlocked && _row < _radius)
+			{
+				isBlocked = true;
+				castOctant(_map, _view, _origin, _forward, _side, _radius, _row + 1, _outerSlope, cellOuterSlope);
+				nextOuterSlope = cellInnerSlope;
+			}
+		}
+
+		// If the row ended on a wall, the rest of the octant has been handled by the recursion.
+		if (isBlocked) { return; }
+	}
+}
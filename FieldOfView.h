@@ -0,0 +1,27 @@
+#ifndef FIELDOFVIEW_H
+#define FIELDOFVIEW_H
+
+// Data includes.
+#include "TileMap.h"
+#include "Point.h"
+#include "Direction.h"
+
+// Typedef includes.
+#include <stdint.h>
+#include <cmath>
+
+namespace WorldObjects
+{
+	/// <summary> Uncovers the cells of a <see cref="TileMap"/> that can be seen from a position, using recursive shadowcasting so that no memory is allocated and each cell is visited at most once per octant. </summary>
+	/// <remarks> Vision is split into octants, each of which is scanned row by row away from the position, narrowing the visible slopes whenever a wall is met. The radius is square, so a row is never further away than the radius. </remarks>
+	class FieldOfView
+	{
+	public:
+		static void UncoverCone(TileMap&, Point, Direction, uint16_t);
+
+		static void UncoverAll(TileMap&, Point, uint16_t);
+	private:
+		static void castOctant(TileMap&, TileMap::View, Point, Point, Point, uint16_t, uint16_t, float_t, float_t);
+	};
+}
+#endif
@@ -0,0 +1,43 @@
+#ifndef FIXEDTIME_H
+#define FIXEDTIME_H
+
+// Derived includes.
+#include "Time.h"
+
+// Typedef includes.
+#include <cmath>
+#include <stdint.h>
+
+namespace Time
+{
+	/// <summary> Represents a gametime that moves forward by the same amount every frame, no matter how long the frame actually took. </summary>
+	class FixedTime : public DeltaTime
+	{
+	public:
+		/// <summary> Creates a new fixed time with the given length of a frame. </summary>
+		/// <param name="_deltaTimeS"> The time each frame takes in seconds. </param>
+		FixedTime(const double_t _deltaTimeS) : m_deltaTimeS(_deltaTimeS), m_frameCount(0) {}
+
+		/// <summary> Moves the time forward by one frame. </summary>
+		inline void					Update()			{ m_frameCount++; }
+
+		/// <summary> Gets the amount of frames that have passed. </summary>
+		/// <returns> The amount of frames. </returns>
+		inline uint64_t				GetFrameCount()		{ return m_frameCount; }
+
+		inline virtual double_t		GetTotalTimeMS()	{ return GetTotalTimeS() * 1000.0; }
+
+		inline virtual double_t		GetTotalTimeS()		{ return m_frameCount * m_deltaTimeS; }
+
+		inline virtual double_t		GetDeltaTimeMS()	{ return m_deltaTimeS * 1000.0; }
+
+		inline virtual double_t		GetDeltaTimeS()		{ return m_deltaTimeS; }
+	private:
+		/// <summary> The time each frame takes in seconds. </summary>
+		double_t m_deltaTimeS;
+
+		/// <summary> The amount of frames that have passed. </summary>
+		uint64_t m_frameCount;
+	};
+}
+#endif
@@ -8,6 +8,7 @@
 
 // Utility includes.
 #include "SpriteData.h"
+#include <cstdio>
 
 /// <summary> Draws the game. </summary>
 void MainGame::Game::draw()
@@ -29,10 +30,24 @@ void MainGame::Game::draw()
 	default: { throw std::exception("Invalid gamestate."); }
 	}
 
+	// Draw the frame time over everything else, if it is shown.
+	if (m_isFrameTimeShown) { drawFrameTime(); }
+
 	// Update the screen with everything that has been drawn.
 	m_SDLGraphics.Present();
 }
 
+/// <summary> Draws the time taken to update and draw recent frames in the top left of the screen. </summary>
+void MainGame::Game::drawFrameTime()
+{
+	// Format the frame time to two decimal places.
+	char frameTimeText[32];
+	snprintf(frameTimeText, sizeof(frameTimeText), "%.2f ms", m_frameTimeMS);
+
+	// Draw the text.
+	m_SDLGraphics.DrawString(SpriteData::FontID::SmallDetail, frameTimeText, m_letterBoxScreen.ScreenToWindowSpace(Point(4, 4)), { 255, 255, 0, 255 });
+}
+
 /// <summary> Updates the game. </summary>
 void MainGame::Game::update()
 {
@@ -72,6 +87,9 @@ void MainGame::Game::initialiseServices()
 	// Initialise events.
 	m_serviceProvider.SetService(&m_events, Services::ServiceType::Events);
 
+	// Initialise the randomness first, as other services draw from its streams.
+	m_serviceProvider.SetService(&m_random, Services::ServiceType::Random);
+
 	// Initialise and add the logger.
 	Logging::ConsoleLogger* logger = new Logging::ConsoleLogger();
 	m_serviceProvider.SetService(logger, Services::ServiceType::Logger);
@@ -81,7 +99,7 @@ void MainGame::Game::initialiseServices()
 	m_serviceProvider.SetService(&m_SDLGraphics, Services::ServiceType::Graphics);
 
 	// Initialise and add the audio.
-	m_SDLAudio.Initialise(*logger);
+	m_SDLAudio.Initialise(*logger, m_random.GetStream(Random::StreamType::Audio));
 	m_serviceProvider.SetService(&m_SDLAudio, Services::ServiceType::Audio);
 
 	// Initialise and add the controls.
@@ -90,6 +108,7 @@ void MainGame::Game::initialiseServices()
 	m_serviceProvider.SetService(keyboardControls, Services::ServiceType::Controls);
 
 	// Initialise the screen.
+	m_letterBoxScreen.SetRandomStream(m_random.GetStream(Random::StreamType::Interface));
 	m_serviceProvider.SetService(&m_letterBoxScreen, Services::ServiceType::Screen);
 
 	// Initialise the time.
@@ -97,6 +116,7 @@ void MainGame::Game::initialiseServices()
 
 	// Initialise the particles.
 	m_particles.SetSheetID(SpriteData::SheetID::Particles);
+	m_particles.SetRandomStream(m_random.GetStream(Random::StreamType::Particles));
 	m_serviceProvider.SetService(&m_particles, Services::ServiceType::Particles);
 }
 
@@ -110,6 +130,9 @@ void MainGame::Game::initialiseBindings()
 	// Bind the window resizing.
 	m_events.AddFrameworkListener(SDL_WINDOWEVENT, std::bind(&Game::resizeScreen, this, std::placeholders::_1));
 
+	// Bind the debug keys.
+	m_events.AddFrameworkListener(SDL_KEYDOWN, std::bind(&Game::handleDebugKeys, this, std::placeholders::_1));
+
 	// Bind the game quit.
 	m_events.AddFrameworkListener(SDL_QUIT, std::bind(&Game::exitGame, this, std::placeholders::_1));
 	m_events.AddUserListener(Events::UserEvent::QuitGame, std::bind(&Game::exitGame, this, std::placeholders::_1));
@@ -134,6 +157,23 @@ void MainGame::Game::initialiseGameObjects()
 	m_world.Initialise(m_events);
 }
 
+/// <summary> Handles the keys used to measure performance, which work in any state. </summary>
+/// <param name="_context"> The context of the event. </param>
+void MainGame::Game::handleDebugKeys(Events::EventContext* _context)
+{
+	// Get the command from the scancode.
+	SDL_Scancode scancode = *static_cast<SDL_Scancode*>(_context->m_data1);
+	Controls::Command currentCommand = m_serviceProvider.GetService<Controls::Controls>(Services::ServiceType::Controls).GetCommandFromKey(scancode);
+
+	// Toggle the frame time or how the map is drawn, so that the two ways can be compared.
+	switch (currentCommand)
+	{
+	case Controls::Command::ToggleFrameTime:	{ m_isFrameTimeShown = !m_isFrameTimeShown; break; }
+	case Controls::Command::ToggleChunkCache:	{ m_world.GetCamera().ToggleChunkCache(); break; }
+	default:									{ break; }
+	}
+}
+
 /// <summary> Loads all textures to the graphics service. </summary>
 void MainGame::Game::loadTextures()
 {
@@ -291,7 +331,7 @@ void MainGame::Game::winGame(Events::EventContext*)
 void MainGame::Game::startGame(Events::EventContext*)
 {
 	// Reset the world.
-	m_world.Reset();
+	m_world.Reset(m_serviceProvider);
 
 	// Set the game state to ingame.
 	m_currentGameState = GameState::Map;
@@ -313,12 +353,19 @@ void MainGame::Game::Run()
 	// Keep running for as long as the game state is not exit.
 	while (m_currentGameState != GameState::Exit)
 	{
+		// Keep track of when the frame started.
+		uint64_t frameStart = SDL_GetPerformanceCounter();
+
 		// Update the game state.
 		update();
 
 		// Draw the current game state.
 		draw();
 
+		// Smooth the time taken to update and draw into the frame time, ignoring the wait so that the actual work is measured.
+		double_t frameTimeMS = (double_t)(SDL_GetPerformanceCounter() - frameStart) * 1000.0 / SDL_GetPerformanceFrequency();
+		m_frameTimeMS += (frameTimeMS - m_frameTimeMS) * 0.1;
+
 		// Wait based on the fps.
 		SDL_Delay((uint32_t)(1000.0f / (float_t)m_SDLGraphics.m_framesPerSecond));
 	}
@@ -13,6 +13,7 @@
 #include "LetterBoxScreen.h"
 #include "GameTime.h"
 #include "ExplodingParticles.h"
+#include "RandomService.h"
 #include "EventContext.h"
 
 // Utility includes.
@@ -59,6 +60,9 @@ namespace MainGame
 		/// <summary> The particles service which allows for updating. </summary>
 		Particles::ExplodingParticles m_particles;
 
+		/// <summary> The random service which holds a random stream for each subsystem. </summary>
+		Random::RandomService		m_random;
+
 		/// <summary> The main menu. </summary>
 		UserInterface::MainMenu		m_mainMenu;
 
@@ -68,8 +72,16 @@ namespace MainGame
 		/// <summary> The mining minigame. </summary>
 		Minigames::MiningMinigame	m_miningMinigame;
 
+		/// <summary> <c>true</c> if the frame time is drawn over the game; otherwise, <c>false</c>. </summary>
+		bool						m_isFrameTimeShown = false;
+
+		/// <summary> The time taken to update and draw a frame in milliseconds, smoothed over recent frames so that it can be read. </summary>
+		double_t					m_frameTimeMS = 0;
+
 		void draw();
 
+		void drawFrameTime();
+
 		void update();
 
 		void initialiseServices();
@@ -84,6 +96,8 @@ namespace MainGame
 
 		void unload();
 
+		void handleDebugKeys(Events::EventContext*);
+
 		void startMinigame(Events::EventContext*);
 
 		void stopMinigame(Events::EventContext* = NULL);
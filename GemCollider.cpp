@@ -3,6 +3,9 @@
 // Data includes.
 #include "Rectangle.h"
 
+// Utility includes.
+#include <algorithm>
+
 /// <summary> Finds if the given <see cref="GemCollider"/> at the given position collides with this <see cref="GemCollider"/>. </summary>
 /// <param name="_position"> The position of the other <see cref="GemCollider"/> relative to this <see cref="GemCollider"/>. </param>
 /// <param name="_other"> The <see cref="GemCollider"/> against which to check for a collision. </param>
@@ -10,13 +13,16 @@
 bool Minigames::GemCollider::CollidesWith(const Point _position, const GemCollider _other) const
 {
 	// If the two gems don't intersect at all regardless of data, there is no collision.
-	if (!Rectangle(0, 0, m_width, m_height).Intersects(Rectangle(_position, Point(_other.m_width, _other.m_height)))) { return false; }
+	if (!Rectangle(0, 0, m_shape->m_width, m_shape->m_height).Intersects(Rectangle(_position, Point(_other.m_shape->m_width, _other.m_shape->m_height)))) { return false; }
 
-	// Only check the x range of the intersecting area of the rectangles.
-	for (uint32_t x = std::max(0, _position.x), otherX = std::abs(std::min(0, _position.x)); x < std::min((int32_t)m_width, _position.x + _other.m_width); x++, otherX++)
+	// Only check the rows of the intersecting area, shifting each row of the other collider into the columns of this one.
+	for (int32_t y = std::max(0, _position.y); y < std::min((int32_t)m_shape->m_height, _position.y + _other.m_shape->m_height); y++)
 	{
-		// If the two starts and heights intersect at all, there is a collision.
-		if (CollidesWith(Point(x, _other.getColumnStart(otherX) + _position.y)) || _other.CollidesWith(Point(otherX, getColumnStart(x) - _position.y))) { return true; }
+		uint32_t otherRow = _other.m_shape->m_rows[y - _position.y];
+		otherRow = (_position.x >= 0) ? otherRow << _position.x : otherRow >> -_position.x;
+
+		// If any cell of the rows is shared, there is a collision.
+		if ((m_shape->m_rows[y] & otherRow) != 0) { return true; }
 	}
 
 	// If no collision was found, return false.
@@ -31,11 +37,11 @@ bool Minigames::GemCollider::CollidesWith(const Point _position, const GemCollid
 bool Minigames::GemCollider::IsFullyCovered(const Point _position, const uint8_t _layer, WallData& _wallData) const
 {
 	// Go over each tile within the collider, if any are below the given layer, return false
-	for (uint8_t x = 0; x < m_width; x++)
+	for (uint8_t y = 0; y < m_shape->m_height; y++)
 	{
-		for (uint8_t y = getColumnStart(x); y < getColumnHeight(x); y++)
+		for (uint8_t x = 0; (m_shape->m_coverRows[y] >> x) != 0; x++)
 		{
-			if (_wallData.GetValueAt(_position.x + x, _position.y + y) < _layer) { return false; }
+			if (((m_shape->m_coverRows[y] >> x) & 1) && _wallData.GetValueAt(_position.x + x, _position.y + y) < _layer) { return false; }
 		}
 	}
 
@@ -51,11 +57,11 @@ bool Minigames::GemCollider::IsFullyCovered(const Point _position, const uint8_t
 bool Minigames::GemCollider::IsFullyUncovered(const Point _position, const uint8_t _layer, WallData& _wallData) const
 {
 	// Go over each tile within the collider, if any are above or at the given layer, return false
-	for (uint8_t x = 0; x < m_width; x++)
+	for (uint8_t y = 0; y < m_shape->m_height; y++)
 	{
-		for (uint8_t y = getColumnStart(x); y < getColumnHeight(x); y++)
+		for (uint8_t x = 0; (m_shape->m_coverRows[y] >> x) != 0; x++)
 		{
-			if (_wallData.GetValueAt(_position.x + x, _position.y + y) >= _layer) { return false; }
+			if (((m_shape->m_coverRows[y] >> x) & 1) && _wallData.GetValueAt(_position.x + x, _position.y + y) >= _layer) { return false; }
 		}
 	}
 
@@ -63,5 +69,32 @@ bool Minigames::GemCollider::IsFullyUncovered(const Point _position, const uint8
 	return true;
 }
 
+/// <summary> Creates the rows of a shape from the start and height of each of its columns. </summary>
+/// <param name="_width"> The width of the shape. </param>
+/// <param name="_height"> The height of the shape. </param>
+/// <param name="_columns"> The list of pairs, with the first being the starting position of a column, and the second being a height. </param>
+/// <returns> The created shape. </returns>
+Minigames::GemCollider::Shape Minigames::GemCollider::createShape(const uint8_t _width, const uint8_t _height, const std::initializer_list<std::pair<uint8_t, uint8_t>> _columns)
+{
+	// If the shape does not fit into the rows, it cannot be made.
+	if (_width > c_maxSize || _height > c_maxSize) { throw std::exception("Gem shapes cannot be larger than the maximum size."); }
+
+	Shape shape = Shape();
+	shape.m_width = _width;
+	shape.m_height = _height;
+
+	// Set the bit of each column in every row it covers.
+	uint8_t x = 0;
+	for (std::initializer_list<std::pair<uint8_t, uint8_t>>::const_iterator column = _columns.begin(); column != _columns.end(); column++, x++)
+	{
+		for (uint8_t y = column->first; y < column->first + column->second; y++) { shape.m_rows[y] |= (1 << x); }
+
+		// The wall only has to be mined from the start of the column down to its height for the gem to be uncovered.
+		for (uint8_t y = column->first; y < column->second; y++) { shape.m_coverRows[y] |= (1 << x); }
+	}
+
+	return shape;
+}
+
 // Initialise the colliders.
-Minigames::GemCollider::colliders Minigames::GemCollider::s_colliders = Minigames::GemCollider::colliders();
\ No newline at end of file
+Minigames::GemCollider::colliders Minigames::GemCollider::s_colliders = Minigames::GemCollider::colliders();
@@ -7,7 +7,7 @@
 
 // Utility includes.
 #include "SpriteData.h"
-#include <vector>
+#include <initializer_list>
 #include <utility>
 
 // Typedef includes.
@@ -16,9 +16,13 @@
 namespace Minigames
 {
 	/// <summary> Represents a generic gem collider. </summary>
+	/// <remarks> Each shape is held as one bitmask per row, where bit x is set if column x is part of the shape, so that two shapes can be tested a whole row at a time. </remarks>
 	class GemCollider
 	{
 	public:
+		/// <summary> The widest and tallest a shape can be, which is the amount of bits in a row. </summary>
+		static const uint8_t c_maxSize = 16;
+
 		/// <summary> Creates and returns the <see cref="GemCollider"/> from a given Gem ID. </summary>
 		/// <param name="_gemID"> The ID of the desired gem. </param>
 		/// <returns> A <see cref="GemCollider"/> tied to the given ID. </returns>
@@ -26,10 +30,10 @@ namespace Minigames
 		{
 			switch (_gemID)
 			{
-			case SpriteData::GemID::Ruby: { return GemCollider(5, 5, s_colliders.m_rubyCollider); break; }
-			case SpriteData::GemID::Diamond: { return GemCollider(5, 4, s_colliders.m_diamondCollider); break; }
-			case SpriteData::GemID::Sapphire: { return GemCollider(9, 9, s_colliders.m_sapphireCollider); break; }
-			case SpriteData::GemID::Emerald: { return GemCollider(10, 10, s_colliders.m_emeraldCollider); break; }
+			case SpriteData::GemID::Ruby: { return GemCollider(s_colliders.m_rubyCollider); break; }
+			case SpriteData::GemID::Diamond: { return GemCollider(s_colliders.m_diamondCollider); break; }
+			case SpriteData::GemID::Sapphire: { return GemCollider(s_colliders.m_sapphireCollider); break; }
+			case SpriteData::GemID::Emerald: { return GemCollider(s_colliders.m_emeraldCollider); break; }
 			default: { throw std::exception("Given gem ID was invalid."); break; }
 			}
 		}
@@ -37,7 +41,7 @@ namespace Minigames
 		/// <summary> Finds if the given position collides with this collider. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the position collides; otherwise, <c>false</c>. </returns>
-		inline bool		CollidesWith(const Point _position) const { return (Rectangle(0, 0, m_width, m_height).IsPointInside(_position)) ? (_position.y >= getColumnStart(_position.x) && _position.y < getColumnStart(_position.x) + getColumnHeight(_position.x)) : false; }
+		inline bool		CollidesWith(const Point _position) const { return (Rectangle(0, 0, m_shape->m_width, m_shape->m_height).IsPointInside(_position)) ? ((m_shape->m_rows[_position.y] >> _position.x) & 1) != 0 : false; }
 
 		bool			CollidesWith(Point, GemCollider) const;
 
@@ -45,65 +49,85 @@ namespace Minigames
 
 		bool			IsFullyUncovered(Point, uint8_t, WallData&) const;
 
+		/// <summary> Calls the given function with each cell that is checked by <see cref="IsFullyCovered"/> and <see cref="IsFullyUncovered"/>. </summary>
+		/// <param name="_visitor"> Called with the position of each cell, relative to the top-left of this collider. </param>
+		template <class Visitor> void VisitCoverCells(Visitor _visitor) const
+		{
+			for (uint8_t y = 0; y < m_shape->m_height; y++)
+			{
+				for (uint8_t x = 0; (m_shape->m_coverRows[y] >> x) != 0; x++) { if ((m_shape->m_coverRows[y] >> x) & 1) { _visitor(Point(x, y)); } }
+			}
+		}
+
 		/// <summary> Gets the width of this collider. </summary>
 		/// <returns> The width of this collider. </returns>
-		inline uint8_t	GetWidth() const { return m_width; }
+		inline uint8_t	GetWidth() const { return m_shape->m_width; }
 
 		/// <summary> Gets the height of this collider. </summary>
 		/// <returns> The height of this collider. </returns>
-		inline uint8_t	GetHeight() const { return m_height; }
+		inline uint8_t	GetHeight() const { return m_shape->m_height; }
+
+		/// <summary> Gets the cells of the given row that are part of this collider. </summary>
+		/// <param name="_y"> The row, from <c>0</c> to the height. </param>
+		/// <returns> The row, where bit x is set if column x is part of this collider. </returns>
+		inline uint16_t	GetRow(const uint8_t _y) const { return m_shape->m_rows[_y]; }
+
+		/// <summary> Gets the cells of the given row that are checked by <see cref="IsFullyCovered"/> and <see cref="IsFullyUncovered"/>. </summary>
+		/// <param name="_y"> The row, from <c>0</c> to the height. </param>
+		/// <returns> The row, where bit x is set if column x is checked. </returns>
+		inline uint16_t	GetCoverRow(const uint8_t _y) const { return m_shape->m_coverRows[_y]; }
 	private:
-		/// <summary> Creates a gem collider with the given width, height, and data. </summary>
-		/// <param name="_width"> The width. </param>
-		/// <param name="_height"> The height. </param>
-		/// <param name="_data"> The data. </param>
-		GemCollider(const uint8_t _width, const uint8_t _height, std::vector<std::pair<uint8_t, uint8_t>>& _data) : m_width(_width), m_height(_height), m_columnStartsAndHeights(&_data) {}
+		/// <summary> Represents the rows of a single gem shape. </summary>
+		struct Shape
+		{
+			/// <summary> The width of the shape. </summary>
+			uint8_t		m_width;
 
-		/// <summary> The width of the collider. </summary>
-		uint8_t m_width;
+			/// <summary> The height of the shape. </summary>
+			uint8_t		m_height;
 
-		/// <summary> The height of the collider. </summary>
-		uint8_t m_height;
+			/// <summary> The cells of each row that are part of the shape. </summary>
+			uint16_t	m_rows[c_maxSize];
+
+			/// <summary> The cells of each row that have to be mined for the gem to be uncovered. </summary>
+			uint16_t	m_coverRows[c_maxSize];
+		};
 
-		/// <summary> The list of pairs, with the first being the starting position of a column, and the second being a height. </summary>
-		std::vector<std::pair<uint8_t, uint8_t>>* m_columnStartsAndHeights;
+		/// <summary> Creates a gem collider with the given shape. </summary>
+		/// <param name="_shape"> The shape, which is shared between every collider of the same gem. </param>
+		GemCollider(const Shape& _shape) : m_shape(&_shape) {}
 
-		/// <summary> Gets the starting position of a column from the given x position. </summary>
-		/// <param name="_xPosition"> The x position. </param>
-		/// <returns> The starting position of a column from the given x position. </returns>
-		inline uint8_t getColumnStart(const uint8_t _xPosition) const { return (*m_columnStartsAndHeights)[_xPosition].first; }
+		/// <summary> The shape of the collider. </summary>
+		const Shape* m_shape;
 
-		/// <summary> Gets the height of a column from the given x position. </summary>
-		/// <param name="_xPosition"> The x position. </param>
-		/// <returns> The height of a column from the given x position. </returns>
-		inline uint8_t getColumnHeight(const uint8_t _xPosition) const { return (*m_columnStartsAndHeights)[_xPosition].second; }
+		static Shape createShape(uint8_t, uint8_t, std::initializer_list<std::pair<uint8_t, uint8_t>>);
 
 		/// <summary> Represents the colliders for each gem. </summary>
 		class colliders
 		{
 		public:
 			/// <summary> The collider for a ruby. </summary>
-			std::vector<std::pair<uint8_t, uint8_t>> m_rubyCollider
+			Shape m_rubyCollider = createShape(5, 5,
 			{
 				std::pair<uint8_t, uint8_t> { 2, 2 },
 				std::pair<uint8_t, uint8_t> { 1, 4 },
 				std::pair<uint8_t, uint8_t> { 0, 5 },
 				std::pair<uint8_t, uint8_t> { 0, 4 },
 				std::pair<uint8_t, uint8_t> { 0, 3 },
-			};
+			});
 
 			/// <summary> The collider for a diamond. </summary>
-			std::vector<std::pair<uint8_t, uint8_t>> m_diamondCollider
+			Shape m_diamondCollider = createShape(5, 4,
 			{
 				std::pair<uint8_t, uint8_t> { 1, 1 },
 				std::pair<uint8_t, uint8_t> { 0, 3 },
 				std::pair<uint8_t, uint8_t> { 0, 4 },
 				std::pair<uint8_t, uint8_t> { 0, 3 },
 				std::pair<uint8_t, uint8_t> { 1, 1 },
-			};
+			});
 
 			/// <summary> The collider for a sapphire. </summary>
-			std::vector<std::pair<uint8_t, uint8_t>> m_sapphireCollider
+			Shape m_sapphireCollider = createShape(9, 9,
 			{
 				std::pair<uint8_t, uint8_t> { 3, 3 },
 				std::pair<uint8_t, uint8_t> { 2, 5 },
@@ -114,10 +138,10 @@ namespace Minigames
 				std::pair<uint8_t, uint8_t> { 1, 7 },
 				std::pair<uint8_t, uint8_t> { 2, 5 },
 				std::pair<uint8_t, uint8_t> { 3, 3 },
-			};
+			});
 
 			/// <summary> The collider for an emerald. </summary>
-			std::vector<std::pair<uint8_t, uint8_t>> m_emeraldCollider
+			Shape m_emeraldCollider = createShape(10, 10,
 			{
 				std::pair<uint8_t, uint8_t> { 5, 2 },
 				std::pair<uint8_t, uint8_t> { 4, 4 },
@@ -129,7 +153,7 @@ namespace Minigames
 				std::pair<uint8_t, uint8_t> { 1, 6 },
 				std::pair<uint8_t, uint8_t> { 2, 4 },
 				std::pair<uint8_t, uint8_t> { 3, 2 },
-			};
+			});
 		};
 
 		/// <summary> Statically creates the list of the different types of gem colliders. </summary>
@@ -137,4 +161,4 @@ namespace Minigames
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,76 @@
+#include "GemSeeder.h"
+
+// Utility includes.
+#include <algorithm>
+#include <thread>
+
+// Typedef includes.
+#include <climits>
+
+/// <summary> Spreads prosperity over the walls of the given map, leaving a one cell border untouched. </summary>
+/// <param name="_map"> The map to fill. </param>
+/// <param name="_random"> The random stream to draw from. </param>
+/// <param name="_averageProsperityPerCell"> The amount of prosperity to add, as an average of all cells. </param>
+void MapGeneration::GemSeeder::SeedGems(WorldObjects::TileMap& _map, Random::RandomStream& _random, const uint8_t _averageProsperityPerCell)
+{
+	// Get a view of the map to query.
+	WorldObjects::TileMap::View view = _map.GetView();
+
+	// Gather every wall that can hold prosperity, avoiding the edges.
+	std::vector<Point> walls;
+	walls.reserve((size_t)view.GetArea());
+	view.VisitIDs(Rectangle(1, 1, (int32_t)view.GetWidth() - 2, (int32_t)view.GetHeight() - 2), [&walls](const Point _position, const uint8_t _ID) { if (SpriteData::IsWall(_ID)) { walls.push_back(_position); } });
+
+	// If there are no walls, there is nowhere to put any gems.
+	if (walls.empty()) { return; }
+
+	// Split the walls into chunks, giving each a share of the prosperity based on how many walls it has, and its own stream.
+	int64_t totalProsperity = (int64_t)view.GetArea() * _averageProsperityPerCell;
+	std::vector<GemChunk> chunks;
+	int64_t givenProsperity = 0;
+	for (size_t firstWall = 0; firstWall < walls.size(); firstWall += c_chunkSize)
+	{
+		size_t wallAmount = std::min((size_t)c_chunkSize, walls.size() - firstWall);
+		int64_t prosperity = (totalProsperity * (int64_t)(firstWall + wallAmount)) / (int64_t)walls.size() - givenProsperity;
+		givenProsperity += prosperity;
+		chunks.push_back({ firstWall, wallAmount, prosperity, Random::RandomStream(((uint64_t)_random.Next() << 32) | _random.Next()) });
+	}
+
+	// Seed every chunk, spreading them over the cores, with each chunk writing the prosperity of its own walls.
+	std::vector<uint8_t> prosperities(walls.size(), 0);
+	size_t threadAmount = std::min((size_t)std::max(1u, std::thread::hardware_concurrency()), chunks.size());
+	std::vector<std::thread> threads;
+	for (size_t t = 1; t < threadAmount; t++)
+	{
+		threads.push_back(std::thread([&chunks, &prosperities, t, threadAmount]()
+		{
+			for (size_t c = t; c < chunks.size(); c += threadAmount) { seedChunk(chunks[c], prosperities); }
+		}));
+	}
+	for (size_t c = 0; c < chunks.size(); c += threadAmount) { seedChunk(chunks[c], prosperities); }
+	for (size_t t = 0; t < threads.size(); t++) { threads[t].join(); }
+
+	// Copy the prosperity onto the map.
+	for (size_t i = 0; i < walls.size(); i++)
+	{
+		if (prosperities[i] != 0) { _map.SetCellProsperity(walls[i], prosperities[i]); }
+	}
+}
+
+/// <summary> Spreads the prosperity of the given chunk over its walls, repeatedly picking a random wall and giving it a random amount until none is left. </summary>
+/// <param name="_chunk"> The chunk to seed. </param>
+/// <param name="_prosperities"> The prosperity of every wall, of which only those of the chunk are changed. </param>
+void MapGeneration::GemSeeder::seedChunk(GemChunk& _chunk, std::vector<uint8_t>& _prosperities)
+{
+	int64_t remainingProsperity = _chunk.m_prosperity;
+	while (remainingProsperity > 0)
+	{
+		// Pick a random wall of the chunk.
+		uint8_t& prosperity = _prosperities[_chunk.m_firstWall + _chunk.m_random.Between(0, (int32_t)_chunk.m_wallAmount - 1)];
+
+		// Make sure the prosperity doesn't overflow, then replace the prosperity of the wall and subtract it from the remaining prosperity.
+		int32_t prosperityToAdd = _chunk.m_random.Between(0, UCHAR_MAX - prosperity);
+		prosperity = (uint8_t)prosperityToAdd;
+		remainingProsperity -= prosperityToAdd;
+	}
+}
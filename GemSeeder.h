@@ -0,0 +1,49 @@
+#ifndef GEMSEEDER_H
+#define GEMSEEDER_H
+
+// Data includes.
+#include "TileMap.h"
+#include "Point.h"
+
+// Utility includes.
+#include "Random.h"
+#include <vector>
+
+// Typedef includes.
+#include <stdint.h>
+
+namespace MapGeneration
+{
+	/// <summary> Represents the stage of map generation that spreads prosperity over the walls of a finished map. </summary>
+	/// <remarks>
+	/// The walls are first gathered into a list, so that no picks are wasted on floors. The list is then split into chunks of a fixed size, each getting a share of the prosperity in proportion to its walls.
+	/// Each chunk draws from its own stream and only touches its own walls, so the chunks are spread over every core, and the result only depends on the seed and not on the amount of cores.
+	/// </remarks>
+	class GemSeeder
+	{
+	public:
+		/// <summary> The amount of walls in each chunk. </summary>
+		static const uint32_t c_chunkSize = 4096;
+
+		static void SeedGems(WorldObjects::TileMap&, Random::RandomStream&, uint8_t);
+	private:
+		/// <summary> Represents a chunk of the walls and the prosperity it has to spread over them. </summary>
+		struct GemChunk
+		{
+			/// <summary> The index of the first wall of the chunk. </summary>
+			size_t					m_firstWall;
+
+			/// <summary> The amount of walls in the chunk. </summary>
+			size_t					m_wallAmount;
+
+			/// <summary> The prosperity to spread over the chunk. </summary>
+			int64_t					m_prosperity;
+
+			/// <summary> The stream that the chunk draws from. </summary>
+			Random::RandomStream	m_random;
+		};
+
+		static void seedChunk(GemChunk&, std::vector<uint8_t>&);
+	};
+}
+#endif
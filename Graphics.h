@@ -80,6 +80,13 @@ namespace Graphics
 		/// <param name="_rotation"> The rotation in radians. </param>
 		virtual void Draw(uint16_t _sheetID, uint16_t _textureID, Rectangle _destination, Rectangle _source, float_t _rotation) = 0;
 
+		/// <summary> Starts collecting sprite draws instead of drawing them straight away, so that the draws of each sheet are submitted together when <see cref="EndBatch"/> is called. </summary>
+		/// <remarks> Sprites from the same sheet keep their order, but sprites from different sheets may be drawn out of order, so only sprites that do not overlap another sheet should be batched together. Any other draw submits the batch first. </remarks>
+		virtual void BeginBatch() = 0;
+
+		/// <summary> Submits every sprite draw collected since <see cref="BeginBatch"/> and goes back to drawing straight away. </summary>
+		virtual void EndBatch() = 0;
+
 		/// <summary> Draws the given string with the given font at the given position and colour. </summary>
 		/// <param name="_fontID"> The ID of the font. </param>
 		/// <param name="_text"> The text to write. </param>
@@ -94,6 +101,46 @@ namespace Graphics
 		/// <param name="_colour"> The colour. </param>
 		virtual void DrawString(uint16_t _fontID, std::string _text, Rectangle _destination, Colour _colour) = 0;
 
+		/// <summary> Creates a blank canvas with the given ID and size, whose pixels can be written to directly, replacing any canvas that already has the ID. </summary>
+		/// <param name="_canvasID"> The ID of the canvas. </param>
+		/// <param name="_size"> The width and height of the canvas in pixels. </param>
+		virtual void CreateCanvas(uint16_t _canvasID, Point _size) = 0;
+
+		/// <summary> Creates a blank canvas with the given ID and size that can be drawn onto like the screen, replacing any canvas that already has the ID. </summary>
+		/// <param name="_canvasID"> The ID of the canvas. </param>
+		/// <param name="_size"> The width and height of the canvas in pixels. </param>
+		virtual void CreateTargetCanvas(uint16_t _canvasID, Point _size) = 0;
+
+		/// <summary> Makes every following draw and clear go to the given canvas instead of the screen, until <see cref="EndCanvasDraw"/> is called. </summary>
+		/// <param name="_canvasID"> The ID of the canvas, which must have been made with <see cref="CreateTargetCanvas"/>. </param>
+		virtual void BeginCanvasDraw(uint16_t _canvasID) = 0;
+
+		/// <summary> Makes every following draw and clear go to the screen again. </summary>
+		virtual void EndCanvasDraw() = 0;
+
+		/// <summary> Writes the given pixels to the given area of the given canvas. </summary>
+		/// <param name="_canvasID"> The ID of the canvas. </param>
+		/// <param name="_area"> The area of the canvas to write. </param>
+		/// <param name="_pixels"> The new pixels of the area in row-major order, one per pixel of the area. </param>
+		virtual void SetCanvasPixels(uint16_t _canvasID, Rectangle _area, const Colour* _pixels) = 0;
+
+		/// <summary> Draws the given canvas at the given destination. </summary>
+		/// <param name="_canvasID"> The ID of the canvas. </param>
+		/// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
+		virtual void DrawCanvas(uint16_t _canvasID, Rectangle _destination) = 0;
+
+		/// <summary> Draws the given area of the given canvas at the given destination. </summary>
+		/// <param name="_canvasID"> The ID of the canvas. </param>
+		/// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
+		/// <param name="_source"> The source <see cref="Rectangle"/>. </param>
+		virtual void DrawCanvas(uint16_t _canvasID, Rectangle _destination, Rectangle _source) = 0;
+
+		/// <summary> Gets the colour of the centre of the given texture from the given sheet, which can stand in for the texture when drawn as a single pixel. </summary>
+		/// <param name="_sheetID"> The ID of the sheet from which the texture is stored. </param>
+		/// <param name="_textureID"> The ID of the texture itself. </param>
+		/// <returns> The colour of the centre pixel of the texture. </returns>
+		virtual Colour GetSpriteColour(uint16_t _sheetID, uint16_t _textureID) = 0;
+
 		/// <summary> The number of frames drawn in a second. </summary>
 		int32_t m_framesPerSecond = 30;
 	};
@@ -0,0 +1,243 @@
+#include "HeadlessGame.h"
+
+// Utility includes.
+#include <sstream>
+#include <exception>
+
+/// <summary> Creates the game with null services and initialises the world and minigame. </summary>
+MainGame::HeadlessGame::HeadlessGame() : m_currentGameState(GameState::MainMenu), m_fixedTime(1.0 / 60.0), m_random(0)
+{
+	initialiseServices();
+
+	initialiseBindings();
+}
+
+/// <summary> Runs the given script one line at a time, running a frame after each command, until the script ends or the game exits. </summary>
+/// <param name="_script"> The script to run. </param>
+/// <remarks>
+/// Each line holds one command:
+/// <c>start</c> starts a new game, <c>menu</c> goes back to the main menu, <c>quit</c> exits, <c>seed N</c> reseeds every random stream,
+/// <c>key Name</c> presses the key bound to the named command or the given scancode,
+/// <c>click X Y</c> clicks at the given screen position,
+/// <c>wait N</c> runs the given amount of frames without input,
+/// <c>fuzz N</c> runs the given amount of frames with a random key press or click each,
+/// and <c>check</c> stops the script with an error if the current floor has no valid spawn and exit.
+/// Empty lines and lines starting with <c>#</c> are skipped.
+/// </remarks>
+void MainGame::HeadlessGame::RunScript(std::istream& _script)
+{
+	std::string currentLine;
+	while (m_currentGameState != GameState::Exit && std::getline(_script, currentLine))
+	{
+		// Skip empty lines and comments.
+		if (currentLine.empty() || currentLine[0] == '#') { continue; }
+
+		runCommand(currentLine);
+	}
+}
+
+/// <summary> Runs a single frame of the game as fast as possible. </summary>
+void MainGame::HeadlessGame::update()
+{
+	// Update the time.
+	m_fixedTime.Update();
+
+	// Pump the events service.
+	m_events.PumpEvents(m_currentGameState, m_serviceProvider);
+
+	// Update the particles.
+	m_particles.Update(m_fixedTime);
+}
+
+/// <summary> Runs the given script command. </summary>
+/// <param name="_command"> The line of the script holding the command. </param>
+void MainGame::HeadlessGame::runCommand(const std::string& _command)
+{
+	// Read the name of the command.
+	std::istringstream commandStream(_command);
+	std::string commandName;
+	commandStream >> commandName;
+
+	// Can't switch on strings, so just check to see if the name matches anything.
+	if (commandName == "start")			{ m_events.PushEvent(Events::UserEvent::StartGame, NULL, NULL); }
+	else if (commandName == "menu")		{ m_events.PushEvent(Events::UserEvent::MainMenu, NULL, NULL); }
+	else if (commandName == "quit")		{ m_events.PushQuit(); }
+	else if (commandName == "seed")
+	{
+		uint64_t seed = 0;
+		commandStream >> seed;
+		m_random.Seed(seed);
+	}
+	else if (commandName == "key")
+	{
+		std::string keyName;
+		commandStream >> keyName;
+		pushKey(keyName);
+	}
+	else if (commandName == "click")
+	{
+		Point position;
+		commandStream >> position.x >> position.y;
+		m_events.PushMouseDown(position);
+	}
+	else if (commandName == "wait")
+	{
+		// Run every frame but the last here, the last is run along with every other command.
+		uint32_t frames = 0;
+		commandStream >> frames;
+		for (uint32_t i = 1; i < frames && m_currentGameState != GameState::Exit; i++) { update(); }
+	}
+	else if (commandName == "check")
+	{
+		// Make sure the current floor was fully generated, which means both the spawn and exit are on clear cells within the playable area.
+		WorldObjects::IReadOnlyTileMap& tileMap = m_world.GetTileMap();
+		Point spawnPosition = m_world.GetSpawn().GetTilePosition();
+		Point exitPosition = m_world.GetExit().GetTilePosition();
+		if (!tileMap.IsCellInPlayableArea(spawnPosition) || !tileMap.IsCellClear(spawnPosition)) { throw std::exception("The spawn of the current floor is not on a clear cell."); }
+		if (!tileMap.IsCellInPlayableArea(exitPosition) || !tileMap.IsCellClear(exitPosition)) { throw std::exception("The exit of the current floor is not on a clear cell."); }
+		if (spawnPosition == exitPosition) { throw std::exception("The spawn and exit of the current floor are in the same place."); }
+	}
+	else if (commandName == "fuzz")
+	{
+		uint32_t frames = 0;
+		commandStream >> frames;
+		for (uint32_t i = 1; i < frames && m_currentGameState != GameState::Exit; i++) { pushRandomInput(); update(); }
+		pushRandomInput();
+	}
+	else { throw std::exception("Unknown command in headless script."); }
+
+	// Run the frame for the command.
+	update();
+}
+
+/// <summary> Pushes a random key press or click that could affect the game in its current state. </summary>
+void MainGame::HeadlessGame::pushRandomInput()
+{
+	// The names of the keys that do something in the game.
+	static const char* c_keyNames[] = { "Up", "Down", "Left", "Right", "Interact", "Swing", "30", "31", "32" };
+
+	// Draw from the input stream, so that the inputs do not change what the game itself rolls.
+	Random::RandomStream& random = m_random.GetStream(Random::StreamType::Input);
+
+	switch (m_currentGameState)
+	{
+	// In the minigame, mostly mine at random, but sometimes change tool.
+	case GameState::Minigame:
+	{
+		if (random.Between(0, 9) == 0) { pushKey(c_keyNames[random.Between(6, 8)]); }
+		else { m_events.PushMouseDown(Point(random.Between(0, c_windowWidth - 1), random.Between(0, c_windowHeight - 1))); }
+		break;
+	}
+	// On the map, press one of the game keys.
+	case GameState::Map: { pushKey(c_keyNames[random.Between(0, 5)]); break; }
+	// Otherwise, start a new game.
+	default: { m_events.PushEvent(Events::UserEvent::StartGame, NULL, NULL); break; }
+	}
+}
+
+/// <summary> Pushes a press of the key with the given name. </summary>
+/// <param name="_keyName"> The name of a command from the bindings file, or a scancode. </param>
+void MainGame::HeadlessGame::pushKey(const std::string& _keyName)
+{
+	// If the name is a command, press the key bound to it.
+	Controls::Command command = Controls::KeyboardControls::GetCommandFromName(_keyName);
+	if (command != Controls::Command::None) { m_events.PushKeyDown((SDL_Scancode)m_keyboardControls.GetKeyForCommand(command)); }
+
+	// Otherwise, read it as a scancode.
+	else { m_events.PushKeyDown((SDL_Scancode)std::stoi(_keyName)); }
+}
+
+/// <summary> Adds each null service to the service provider. </summary>
+void MainGame::HeadlessGame::initialiseServices()
+{
+	m_serviceProvider.SetService(&m_events, Services::ServiceType::Events);
+	m_serviceProvider.SetService(&m_random, Services::ServiceType::Random);
+	m_serviceProvider.SetService(&m_logger, Services::ServiceType::Logger);
+	m_serviceProvider.SetService(&m_nullGraphics, Services::ServiceType::Graphics);
+	m_serviceProvider.SetService(&m_nullAudio, Services::ServiceType::Audio);
+	m_serviceProvider.SetService(&m_nullScreen, Services::ServiceType::Screen);
+	m_serviceProvider.SetService(&m_fixedTime, Services::ServiceType::Time);
+
+	// Use the same key bindings as the game, so that scripts can name commands.
+	m_keyboardControls.LoadFromFile(c_contentFolder + '/' + "Bindings.txt");
+	m_serviceProvider.SetService(&m_keyboardControls, Services::ServiceType::Controls);
+
+	// Initialise the particles.
+	m_particles.SetSheetID(SpriteData::SheetID::Particles);
+	m_particles.SetRandomStream(m_random.GetStream(Random::StreamType::Particles));
+	m_serviceProvider.SetService(&m_particles, Services::ServiceType::Particles);
+}
+
+/// <summary> Hooks up game events to specific functions, the same as the full game. </summary>
+void MainGame::HeadlessGame::initialiseBindings()
+{
+	// Bind the minigame start and end.
+	m_events.AddUserListener(Events::UserEvent::StartMinigame, std::bind(&HeadlessGame::startMinigame, this, std::placeholders::_1));
+	m_events.AddUserListener(Events::UserEvent::StopMinigame, std::bind(&HeadlessGame::stopMinigame, this, std::placeholders::_1));
+
+	// Bind the game quit.
+	m_events.AddFrameworkListener(SDL_QUIT, std::bind(&HeadlessGame::exitGame, this, std::placeholders::_1));
+	m_events.AddUserListener(Events::UserEvent::QuitGame, std::bind(&HeadlessGame::exitGame, this, std::placeholders::_1));
+
+	// Bind the lose/win game.
+	m_events.AddUserListener(Events::UserEvent::PlayerDied, std::bind(&HeadlessGame::loseGame, this, std::placeholders::_1));
+	m_events.AddUserListener(Events::UserEvent::PlayerWon, std::bind(&HeadlessGame::winGame, this, std::placeholders::_1));
+
+	// Bind the start game and main menu.
+	m_events.AddUserListener(Events::UserEvent::StartGame, std::bind(&HeadlessGame::startGame, this, std::placeholders::_1));
+	m_events.AddUserListener(Events::UserEvent::MainMenu, std::bind(&HeadlessGame::endGame, this, std::placeholders::_1));
+
+	// Initialise the minigame and world.
+	m_miningMinigame.Initialise(m_events);
+	m_world.Initialise(m_events);
+}
+
+/// <summary> Starts the mining minigame. </summary>
+/// <param name="_context"> The context of the event. </param>
+void MainGame::HeadlessGame::startMinigame(Events::EventContext* _context)
+{
+	// Cast the data.
+	Point tilePosition = *static_cast<Point*>(_context->m_data1);
+	uint8_t cellProsperity = *static_cast<uint8_t*>(_context->m_data2);
+
+	// Set the current game state to minigame and generate the cave wall.
+	m_currentGameState = GameState::Minigame;
+	m_miningMinigame.Prepare(m_serviceProvider, tilePosition, cellProsperity);
+
+	// Kill particles.
+	m_particles.KillAllAlive();
+}
+
+/// <summary> Stops the mining minigame. </summary>
+void MainGame::HeadlessGame::stopMinigame(Events::EventContext*)
+{
+	m_currentGameState = GameState::Map;
+	m_particles.KillAllAlive();
+}
+
+/// <summary> Fires when the player is crushed or otherwise dies. </summary>
+void MainGame::HeadlessGame::loseGame(Events::EventContext*)
+{
+	m_currentGameState = GameState::Lost;
+	m_particles.KillAllAlive();
+}
+
+/// <summary> Fires when the player makes it to level 10. </summary>
+void MainGame::HeadlessGame::winGame(Events::EventContext*)
+{
+	m_currentGameState = GameState::Won;
+	m_particles.KillAllAlive();
+}
+
+/// <summary> Starts the game. </summary>
+void MainGame::HeadlessGame::startGame(Events::EventContext*)
+{
+	m_world.Reset(m_serviceProvider);
+	m_currentGameState = GameState::Map;
+}
+
+/// <summary> Goes back to the main menu. </summary>
+void MainGame::HeadlessGame::endGame(Events::EventContext*)
+{
+	m_currentGameState = GameState::MainMenu;
+}
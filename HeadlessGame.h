@@ -0,0 +1,128 @@
+#ifndef HEADLESSGAME_H
+#define HEADLESSGAME_H
+
+// Data includes.
+#include "World.h"
+#include "MiningMinigame.h"
+
+// Service includes.
+#include "ServiceProvider.h"
+#include "NullGraphics.h"
+#include "NullAudio.h"
+#include "NullScreen.h"
+#include "ScriptedEvents.h"
+#include "FixedTime.h"
+#include "KeyboardControls.h"
+#include "ConsoleLogger.h"
+#include "ExplodingParticles.h"
+#include "RandomService.h"
+#include "EventContext.h"
+
+// Utility includes.
+#include "GameState.h"
+#include <istream>
+#include <string>
+
+namespace MainGame
+{
+	/// <summary> Represents the game logic without a window, sound, or frame limit, driven by a script of inputs. </summary>
+	class HeadlessGame
+	{
+	public:
+		HeadlessGame();
+
+		// Prevent copies.
+		HeadlessGame(HeadlessGame&) = delete;
+		HeadlessGame& operator=(const HeadlessGame&) = delete;
+
+		void RunScript(std::istream&);
+
+		/// <summary> Gets the current state of the game. </summary>
+		/// <returns> The current <see cref="GameState"/>. </returns>
+		inline GameState				GetGameState() const	{ return m_currentGameState; }
+
+		/// <summary> Gets the amount of frames that have been run. </summary>
+		/// <returns> The amount of frames. </returns>
+		inline uint64_t					GetFrameCount()			{ return m_fixedTime.GetFrameCount(); }
+
+		/// <summary> Gets the map world. </summary>
+		/// <returns> The <see cref="World"/>. </returns>
+		inline WorldObjects::World&		GetWorld()				{ return m_world; }
+	private:
+		/// <summary> The folder in which the content is stored. </summary>
+		const std::string			c_contentFolder = "Content";
+
+		/// <summary> The width of the window that clicks are made in, which is the same as the screen. </summary>
+		const int32_t				c_windowWidth = 960;
+
+		/// <summary> The height of the window that clicks are made in, which is the same as the screen. </summary>
+		const int32_t				c_windowHeight = 540;
+
+		/// <summary> The service provider. </summary>
+		Services::ServiceProvider	m_serviceProvider;
+
+		/// <summary> The current state of the game. </summary>
+		GameState					m_currentGameState;
+
+		/// <summary> The logger service. </summary>
+		Logging::ConsoleLogger		m_logger;
+
+		/// <summary> The graphics service, which draws nothing. </summary>
+		Graphics::NullGraphics		m_nullGraphics;
+
+		/// <summary> The audio service, which plays nothing. </summary>
+		Audio::NullAudio			m_nullAudio;
+
+		/// <summary> The screen service, which is the same as the window. </summary>
+		Screens::NullScreen			m_nullScreen;
+
+		/// <summary> The controls service. </summary>
+		Controls::KeyboardControls	m_keyboardControls;
+
+		/// <summary> The events service, which is fed by the script. </summary>
+		Events::ScriptedEvents		m_events;
+
+		/// <summary> The time service, which moves forward by a sixtieth of a second every frame. </summary>
+		Time::FixedTime				m_fixedTime;
+
+		/// <summary> The particles service. </summary>
+		Particles::ExplodingParticles m_particles;
+
+		/// <summary> The random service, which starts with a seed of <c>0</c> so that every run of a script is the same. </summary>
+		Random::RandomService		m_random;
+
+		/// <summary> The map world. </summary>
+		WorldObjects::World			m_world;
+
+		/// <summary> The mining minigame. </summary>
+		Minigames::MiningMinigame	m_miningMinigame;
+
+		void update();
+
+		void runCommand(const std::string&);
+
+		void pushRandomInput();
+
+		void pushKey(const std::string&);
+
+		void initialiseServices();
+
+		void initialiseBindings();
+
+		void startMinigame(Events::EventContext*);
+
+		void stopMinigame(Events::EventContext* = NULL);
+
+		/// <summary> Sets the game state to exit so that the script stops running. </summary>
+		void exitGame(Events::EventContext* = NULL) { m_currentGameState = GameState::Exit; }
+
+		void loseGame(Events::EventContext* = NULL);
+
+		void winGame(Events::EventContext* = NULL);
+
+		void startGame(Events::EventContext* = NULL);
+
+		void endGame(Events::EventContext* = NULL);
+	};
+}
+#endif
@@ -0,0 +1,36 @@
+// Data includes.
+#include "HeadlessGame.h"
+
+// Utility includes.
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+/// <summary> Runs the game without a window, reading the script from the file given as the first argument or from the standard input. </summary>
+int main(int argc, char * argv[])
+{
+	// Create the game.
+	MainGame::HeadlessGame game;
+
+	// Run the script as fast as possible, timing how long it takes.
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	try
+	{
+		if (argc > 1)
+		{
+			std::ifstream scriptFile(argv[1]);
+			if (!scriptFile.is_open()) { std::cerr << "Script file could not be opened." << std::endl; return 1; }
+			game.RunScript(scriptFile);
+		}
+		else { game.RunScript(std::cin); }
+	}
+	// If the script failed, such as a check not passing, say why and fail.
+	catch (const std::exception& _exception) { std::cerr << "Script failed: " << _exception.what() << std::endl; return 1; }
+	double_t elapsedMS = std::chrono::duration<double_t, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+	// Write out how it went.
+	std::cout << "Frames: " << game.GetFrameCount() << std::endl;
+	std::cout << "Time: " << elapsedMS << " ms (" << (elapsedMS > 0 ? game.GetFrameCount() * 1000.0 / elapsedMS : 0) << " frames per second)" << std::endl;
+	std::cout << "State: " << game.GetGameState() << ", floor: " << game.GetWorld().GetCurrentLevel() << ", gems worth: $" << game.GetWorld().GetPlayer().GetInventory().CalculateCombinedValue() << std::endl;
+	return 0;
+}
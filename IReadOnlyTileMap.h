@@ -6,6 +6,9 @@
 #include "Point.h"
 #include "Rectangle.h"
 
+// Utility includes.
+#include <vector>
+
 // Typedef includes.
 #include <stdint.h>
 
@@ -17,15 +20,15 @@ namespace WorldObjects
 	public:
 		/// <summary> Gets the width of the data. </summary>
 		/// <returns> The width of the data. </returns>
-		virtual uint16_t	GetWidth() = 0;
+		virtual uint32_t	GetWidth() = 0;
 
 		/// <summary> Gets the height of the data. </summary>
 		/// <returns> The height of the data. </returns>
-		virtual uint16_t	GetHeight() = 0;
+		virtual uint32_t	GetHeight() = 0;
 
 		/// <summary> Gets the area of the data. </summary>
 		/// <returns> The width multiplied by the height of the data. </returns>
-		virtual uint16_t	GetArea() = 0;
+		virtual uint32_t	GetArea() = 0;
 
 		/// <summary> Gets the <see cref="Tile"/> at the given position. </summary>
 		/// <param name="_position"> The position whence to get the <see cref="Tile"/>. </param>
@@ -71,6 +74,15 @@ namespace WorldObjects
 		/// <param name="_area"> The area to check. </param>
 		/// <returns> <c>true</c> if not a single clear cell exists within the given area, <c>false</c> otherwise. </returns>
 		virtual bool		AreaIsBlocked(Rectangle _area) = 0;
+
+		/// <summary> Registers a new consumer of the areas that change, such as a renderer that keeps its output between frames. </summary>
+		/// <returns> The ID of the consumer, which starts with the entire map dirty. </returns>
+		virtual uint32_t	RegisterDirtyConsumer() = 0;
+
+		/// <summary> Takes the areas that have changed since the given consumer last consumed them. </summary>
+		/// <param name="_consumerID"> The ID of the consumer. </param>
+		/// <returns> The changed areas, none of which overlap. </returns>
+		virtual std::vector<Rectangle> ConsumeDirtyRegions(uint32_t _consumerID) = 0;
 	};
 }
 #endif
\ No newline at end of file
@@ -32,12 +32,25 @@ void Controls::KeyboardControls::LoadFromFile(const std::string _filePath)
 		int32_t keyCode;
 		currentLineStream >> keyCode;
 
-		// Can't switch on strings, so just check to see if the name matches anything.
-		if (commandName == "Up")			{ BindCommandToKey(Command::MoveUp, keyCode); }
-		else if (commandName == "Down")		{ BindCommandToKey(Command::MoveDown, keyCode); }
-		else if (commandName == "Left")		{ BindCommandToKey(Command::MoveLeft, keyCode); }
-		else if (commandName == "Right")	{ BindCommandToKey(Command::MoveRight, keyCode); }
-		else if (commandName == "Interact") { BindCommandToKey(Command::Interact, keyCode); }
-		else if (commandName == "Swing")	{ BindCommandToKey(Command::Swing, keyCode); }
+		// Bind the command with the name, if there is one.
+		Command command = GetCommandFromName(commandName);
+		if (command != Command::None) { BindCommandToKey(command, keyCode); }
 	}
 }
+
+/// <summary> Gets the <see cref="Command"/> with the given name, as used in the bindings file. </summary>
+/// <param name="_commandName"> The name of the command. </param>
+/// <returns> The command with the given name, or <see cref="Command::None"/> if no command has the name. </returns>
+Controls::Command Controls::KeyboardControls::GetCommandFromName(const std::string _commandName)
+{
+	// Can't switch on strings, so just check to see if the name matches anything.
+	if (_commandName == "Up")				{ return Command::MoveUp; }
+	else if (_commandName == "Down")		{ return Command::MoveDown; }
+	else if (_commandName == "Left")		{ return Command::MoveLeft; }
+	else if (_commandName == "Right")		{ return Command::MoveRight; }
+	else if (_commandName == "Interact")	{ return Command::Interact; }
+	else if (_commandName == "Swing")		{ return Command::Swing; }
+	else if (_commandName == "FrameTime")	{ return Command::ToggleFrameTime; }
+	else if (_commandName == "ChunkCache")	{ return Command::ToggleChunkCache; }
+	else									{ return Command::None; }
+}
@@ -21,6 +21,8 @@ namespace Controls
 		/// <param name="_filePath"> The path of the bindings file. </param>
 		void					LoadFromFile(std::string _filePath);
 
+		static Command			GetCommandFromName(std::string);
+
 		/// <summary> Gets the key associated with the given command. </summary>
 		/// <param name="_command"> The <see cref="Command"/>. </param>
 		/// <returns> The key associated with the given command. </returns>
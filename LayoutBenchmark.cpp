@@ -0,0 +1,180 @@
+#include "LayoutBenchmark.h"
+
+// Data includes.
+#include "Point.h"
+
+// Utility includes.
+#include "Random.h"
+#include <chrono>
+#include <iomanip>
+
+// The storage is only counted as slower when it is more than a tenth slower, as the times vary by about that much between runs.
+const double_t Benchmarks::LayoutBenchmark::c_slowerTolerance = 1.1;
+
+/// <summary> Fills, scans, and queries a map of the given size with both layouts several times, checking that they agree, keeping the fastest time of each, and counting where the storage is slower. </summary>
+/// <remarks> The fastest time is kept as it is the least affected by anything else running at the same time. </remarks>
+/// <param name="_size"> The width and height of the map. </param>
+/// <returns> The measurements of both layouts. </returns>
+Benchmarks::LayoutSample Benchmarks::LayoutBenchmark::Run(const uint32_t _size) const
+{
+	// Make the positions of every query before anything is measured.
+	Random::RandomStream random(m_seed);
+	std::vector<Point> queries(m_queries);
+	for (size_t i = 0; i < queries.size(); i++) { queries[i] = Point(random.Between(0, (int32_t)_size - 1), random.Between(0, (int32_t)_size - 1)); }
+
+	// Keep the fastest of each time, and every mismatch.
+	LayoutSample sample = runOnce(_size, queries);
+	for (uint32_t i = 1; i < c_repeats; i++)
+	{
+		LayoutSample repeat = runOnce(_size, queries);
+		sample.m_oldFillNS = std::min(sample.m_oldFillNS, repeat.m_oldFillNS);
+		sample.m_newFillNS = std::min(sample.m_newFillNS, repeat.m_newFillNS);
+		sample.m_oldScanNS = std::min(sample.m_oldScanNS, repeat.m_oldScanNS);
+		sample.m_newScanNS = std::min(sample.m_newScanNS, repeat.m_newScanNS);
+		sample.m_oldVisibilityNS = std::min(sample.m_oldVisibilityNS, repeat.m_oldVisibilityNS);
+		sample.m_newVisibilityNS = std::min(sample.m_newVisibilityNS, repeat.m_newVisibilityNS);
+		sample.m_oldWalkNS = std::min(sample.m_oldWalkNS, repeat.m_oldWalkNS);
+		sample.m_newWalkNS = std::min(sample.m_newWalkNS, repeat.m_newWalkNS);
+		sample.m_mismatches += repeat.m_mismatches;
+	}
+
+	// Count every measurement where the storage lost to the old layout, so that a regression is reported rather than hidden among the times.
+	double_t oldTimes[] = { sample.m_oldFillNS, sample.m_oldScanNS, sample.m_oldVisibilityNS, sample.m_oldWalkNS };
+	double_t newTimes[] = { sample.m_newFillNS, sample.m_newScanNS, sample.m_newVisibilityNS, sample.m_newWalkNS };
+	for (size_t i = 0; i < sizeof(oldTimes) / sizeof(oldTimes[0]); i++) { if (newTimes[i] > oldTimes[i] * c_slowerTolerance) { sample.m_slower++; } }
+
+	return sample;
+}
+
+/// <summary> Fills, scans, and queries a map of the given size once with both layouts, checking that they agree and timing each. </summary>
+/// <remarks> Each layout is walked the way its own code walks it, so the old layout goes down each column a cell at a time, and the storage goes a chunk at a time, along each row of the chunk as one run. </remarks>
+/// <param name="_size"> The width and height of the map. </param>
+/// <param name="_queries"> The position of each visibility query. </param>
+/// <returns> The measurements of both layouts. </returns>
+Benchmarks::LayoutSample Benchmarks::LayoutBenchmark::runOnce(const uint32_t _size, const std::vector<Point>& _queries) const
+{
+	LayoutSample sample = LayoutSample();
+	sample.m_size = _size;
+	int32_t size = (int32_t)_size;
+	double_t cellAmount = (double_t)_size * _size;
+
+	// Time making the old layout and filling every cell. Making the map is included, as the old layout allocated every column up front while the storage allocates each chunk as it is first written.
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	ColumnLayout columns(_size, std::vector<WorldObjects::Tile>(_size));
+	for (int32_t x = 0; x < size; x++)
+	{
+		for (int32_t y = 0; y < size; y++) { columns[x][y] = WorldObjects::Tile(getFillID(x, y), (uint8_t)(x + y), getFillVisibility(x, y)); }
+	}
+	sample.m_oldFillNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cellAmount;
+
+	// Time making the storage and filling every cell.
+	start = std::chrono::high_resolution_clock::now();
+	WorldObjects::TileStorage storage(_size, _size);
+	visitRuns(size, [&storage](const int32_t _x, const int32_t _y, const int32_t _length)
+	{
+		WorldObjects::TileStorage::WritableTileRun run = storage.GetWritableTileRun(_x, _y);
+		uint64_t visibilities = 0;
+		for (int32_t i = 0; i < _length; i++)
+		{
+			run.m_IDs[i] = getFillID(_x + i, _y);
+			run.m_prosperities[i] = (uint8_t)(_x + i + _y);
+			visibilities |= (uint64_t)getFillVisibility(_x + i, _y) << i;
+		}
+		*run.m_visibilities |= visibilities << run.m_firstBit;
+	});
+	sample.m_newFillNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cellAmount;
+
+	// Time counting the floor of the old layout.
+	uint64_t oldFloor = 0, newFloor = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int32_t x = 0; x < size; x++)
+	{
+		for (int32_t y = 0; y < size; y++) { if (SpriteData::IsFloor(columns[x][y].m_ID)) { oldFloor++; } }
+	}
+	sample.m_oldScanNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cellAmount;
+
+	// Time counting the floor of the storage.
+	start = std::chrono::high_resolution_clock::now();
+	visitRuns(size, [&storage, &newFloor](const int32_t _x, const int32_t _y, const int32_t _length)
+	{
+		const uint8_t* run = storage.GetIDRun(_x, _y);
+		for (int32_t i = 0; i < _length; i++) { if (SpriteData::IsFloor(run[i])) { newFloor++; } }
+	});
+	sample.m_newScanNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cellAmount;
+
+	// If the counts differ, the layouts hold different maps.
+	if (oldFloor != newFloor) { sample.m_mismatches++; }
+
+	// Time the visibility queries of the old layout.
+	uint32_t oldVisible = 0, newVisible = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (size_t i = 0; i < _queries.size(); i++) { if (columns[_queries[i].x][_queries[i].y].m_visibility) { oldVisible++; } }
+	sample.m_oldVisibilityNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / std::max((size_t)1, _queries.size());
+
+	// Time the visibility queries of the storage.
+	start = std::chrono::high_resolution_clock::now();
+	for (size_t i = 0; i < _queries.size(); i++) { if (storage.GetVisibility(_queries[i].x, _queries[i].y)) { newVisible++; } }
+	sample.m_newVisibilityNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / std::max((size_t)1, _queries.size());
+
+	if (oldVisible != newVisible) { sample.m_mismatches++; }
+
+	// Time reading every tile of the old layout going along each row, as the camera and minimap did.
+	uint64_t oldWalked = 0, newWalked = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int32_t y = 0; y < size; y++)
+	{
+		for (int32_t x = 0; x < size; x++)
+		{
+			WorldObjects::Tile tile = columns[x][y];
+			if (tile.m_visibility) { oldWalked += tile.m_ID + tile.m_prosperity; }
+		}
+	}
+	sample.m_oldWalkNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cellAmount;
+
+	// Time reading every tile of the storage through the view, as the camera and minimap now do.
+	start = std::chrono::high_resolution_clock::now();
+	WorldObjects::TileMapView<WorldObjects::TileStorage>(storage).VisitTiles(Rectangle(0, 0, size, size), [&newWalked](const Point, const WorldObjects::Tile _tile)
+	{
+		if (_tile.m_visibility) { newWalked += _tile.m_ID + _tile.m_prosperity; }
+	});
+	sample.m_newWalkNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cellAmount;
+
+	if (oldWalked != newWalked) { sample.m_mismatches++; }
+
+	return sample;
+}
+
+/// <summary> Writes the names of each column of the summaries. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::LayoutBenchmark::WriteHeader(std::ostream& _output, const bool _isCSV)
+{
+	const char* columns[] = { "size", "old_fill_ns", "new_fill_ns", "old_scan_ns", "new_scan_ns", "old_vis_ns", "new_vis_ns", "old_walk_ns", "new_walk_ns", "mismatches", "slower" };
+	for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++)
+	{
+		if (_isCSV) { _output << (i > 0 ? "," : "") << columns[i]; }
+		else { _output << std::setw(12) << columns[i]; }
+	}
+	_output << std::endl;
+}
+
+/// <summary> Writes the given sample on one line. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_sample"> The sample to write. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::LayoutBenchmark::WriteSummary(std::ostream& _output, const LayoutSample& _sample, const bool _isCSV)
+{
+	double_t values[] = { _sample.m_oldFillNS, _sample.m_newFillNS, _sample.m_oldScanNS, _sample.m_newScanNS, _sample.m_oldVisibilityNS, _sample.m_newVisibilityNS, _sample.m_oldWalkNS, _sample.m_newWalkNS };
+
+	if (_isCSV) { _output << _sample.m_size; }
+	else { _output << std::setw(12) << _sample.m_size; }
+	_output << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+	{
+		if (_isCSV) { _output << ',' << values[i]; }
+		else { _output << std::setw(12) << values[i]; }
+	}
+	if (_isCSV) { _output << ',' << _sample.m_mismatches << ',' << _sample.m_slower; }
+	else { _output << std::setw(12) << _sample.m_mismatches << std::setw(12) << _sample.m_slower; }
+	_output << std::defaultfloat << std::endl;
+}
@@ -0,0 +1,120 @@
+#ifndef LAYOUTBENCHMARK_H
+#define LAYOUTBENCHMARK_H
+
+// Data includes.
+#include "Tile.h"
+#include "TileStorage.h"
+#include "TileMapView.h"
+#include "Point.h"
+#include "Rectangle.h"
+
+// Utility includes.
+#include "SpriteData.h"
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+// Typedef includes.
+#include <cmath>
+#include <stdint.h>
+
+namespace Benchmarks
+{
+	/// <summary> Represents the cost of the same work on a map of one size with the old column layout and with <see cref="WorldObjects::TileStorage"/>, and how often they disagreed. </summary>
+	struct LayoutSample
+	{
+		/// <summary> The width and height of the map. </summary>
+		uint32_t	m_size;
+
+		/// <summary> The mean time to fill a cell with the old layout in nanoseconds. </summary>
+		double_t	m_oldFillNS;
+
+		/// <summary> The mean time to fill a cell with the storage in nanoseconds. </summary>
+		double_t	m_newFillNS;
+
+		/// <summary> The mean time to scan a cell with the old layout in nanoseconds. </summary>
+		double_t	m_oldScanNS;
+
+		/// <summary> The mean time to scan a cell with the storage in nanoseconds. </summary>
+		double_t	m_newScanNS;
+
+		/// <summary> The mean time of a visibility query with the old layout in nanoseconds. </summary>
+		double_t	m_oldVisibilityNS;
+
+		/// <summary> The mean time of a visibility query with the storage in nanoseconds. </summary>
+		double_t	m_newVisibilityNS;
+
+		/// <summary> The mean time to read a whole <see cref="WorldObjects::Tile"/> while walking each row, as the <see cref="WorldObjects::Camera"/> does, with the old layout in nanoseconds. </summary>
+		double_t	m_oldWalkNS;
+
+		/// <summary> The mean time to read a whole <see cref="WorldObjects::Tile"/> while walking each row with the storage in nanoseconds. </summary>
+		double_t	m_newWalkNS;
+
+		/// <summary> The amount of scans and queries where the two layouts did not give the same result. </summary>
+		uint32_t	m_mismatches;
+
+		/// <summary> The amount of measurements where the storage was more than <see cref="LayoutBenchmark::c_slowerTolerance"/> times slower than the old layout. </summary>
+		uint32_t	m_slower;
+	};
+
+	/// <summary> Represents a benchmark that fills, scans, and queries the visibility of maps with both the old layout of <see cref="WorldObjects::TileMap"/>, where each column was its own list of <see cref="WorldObjects::Tile"/>, and the current <see cref="WorldObjects::TileStorage"/>. </summary>
+	class LayoutBenchmark
+	{
+	public:
+		/// <summary> Creates a new benchmark that makes the given amount of visibility queries on each map. </summary>
+		/// <param name="_queries"> The amount of visibility queries. </param>
+		/// <param name="_seed"> The seed of the positions of the visibility queries. </param>
+		LayoutBenchmark(const uint32_t _queries, const uint32_t _seed) : m_queries(_queries), m_seed(_seed) {}
+
+		LayoutSample Run(uint32_t) const;
+
+		static void WriteHeader(std::ostream&, bool);
+
+		static void WriteSummary(std::ostream&, const LayoutSample&, bool);
+
+		/// <summary> How many times slower the storage can be than the old layout before the measurement is counted as slower, so that noise is not counted. </summary>
+		static const double_t c_slowerTolerance;
+	private:
+		/// <summary> The amount of times each map is filled, scanned, and queried, of which the fastest time is kept. </summary>
+		static const uint32_t c_repeats = 5;
+
+		/// <summary> The amount of visibility queries. </summary>
+		uint32_t	m_queries;
+
+		/// <summary> The seed of the positions of the visibility queries. </summary>
+		uint32_t	m_seed;
+
+		/// <summary> The old layout of <see cref="WorldObjects::TileMap"/>, kept to compare against, where each column is a separate list indexed <c>[x][y]</c>. </summary>
+		typedef std::vector<std::vector<WorldObjects::Tile>> ColumnLayout;
+
+		LayoutSample runOnce(uint32_t, const std::vector<Point>&) const;
+
+		/// <summary> Gets the ID the given cell is filled with, which makes a pattern of floor and walls. </summary>
+		/// <param name="_x"> The x of the cell. </param>
+		/// <param name="_y"> The y of the cell. </param>
+		/// <returns> The ID of the cell. </returns>
+		static inline uint8_t getFillID(const int32_t _x, const int32_t _y) { return (uint8_t)((((uint32_t)_x * 7 + (uint32_t)_y * 13) % 5 < 2) ? SpriteData::TileID::Floor1 + (_x & 3) : SpriteData::TileID::Wall1 + (_y & 3)); }
+
+		/// <summary> Gets whether the given cell is discovered when filled, which makes a pattern of discovered cells. </summary>
+		/// <param name="_x"> The x of the cell. </param>
+		/// <param name="_y"> The y of the cell. </param>
+		/// <returns> <c>true</c> if the cell is discovered; otherwise, <c>false</c>. </returns>
+		static inline bool getFillVisibility(const int32_t _x, const int32_t _y) { return ((_x ^ _y) & 4) != 0; }
+
+		/// <summary> Calls the given function with every run of a map of the given size in <see cref="WorldObjects::TileStorage"/>, a chunk at a time. </summary>
+		/// <param name="_size"> The width and height of the map. </param>
+		/// <param name="_visit"> The function, taking the x and y of the first cell of the run and its length. </param>
+		template <class Visitor> static void visitRuns(const int32_t _size, Visitor _visit)
+		{
+			for (int32_t chunkY = 0; chunkY < _size; chunkY += WorldObjects::TileStorage::c_chunkSize)
+			{
+				for (int32_t chunkX = 0; chunkX < _size; chunkX += WorldObjects::TileStorage::c_chunkSize)
+				{
+					int32_t maxY = std::min(chunkY + WorldObjects::TileStorage::c_chunkSize, _size);
+					for (int32_t y = chunkY; y < maxY; y++) { _visit(chunkX, y, WorldObjects::TileStorage::GetRunLength(chunkX, _size)); }
+				}
+			}
+		}
+	};
+}
+#endif
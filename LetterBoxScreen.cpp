@@ -6,9 +6,6 @@
 // Data includes.
 #include "Vector2.h"
 
-// Utility includes.
-#include "Random.h"
-
 /// <summary> Shakes the screen with the given strength in pixels. </summary>
 /// <param name="_strength"> The maximum amount in pixels that the screen will move. </param>
 void Screens::LetterBoxScreen::ShakeScreen(const uint16_t _strength)
@@ -25,7 +22,7 @@ void Screens::LetterBoxScreen::ShakeScreen(const uint16_t _strength)
 		m_currentStrength = _strength;
 
 		// Create a random direction and store it.
-		m_currentDirection = M_PI * 2.0f * Random::RandomScalar();
+		m_currentDirection = M_PI * 2.0f * m_random->Scalar();
 	}
 }
 
@@ -41,7 +38,7 @@ void Screens::LetterBoxScreen::Update(Time::DeltaTime& _gameTime)
 	m_offset = Point((float_t)calculatedOffset.x, (float_t)calculatedOffset.y);
 
 	// Create a random direction based off the previous.
-	m_currentDirection += (M_PI * 0.75f) + ((M_PI / 2.0f) * Random::RandomScalar());
+	m_currentDirection += (M_PI * 0.75f) + ((M_PI / 2.0f) * m_random->Scalar());
 
 	// Reduce the strength per second.
 	m_currentStrength *= 1.0f - (c_strengthDecay *_gameTime.GetDeltaTimeS());
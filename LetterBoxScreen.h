@@ -8,6 +8,7 @@
 #include "Time.h"
 
 // Utility includes.
+#include "Random.h"
 #include <math.h>
 
 namespace Screens
@@ -16,7 +17,7 @@ namespace Screens
 	class LetterBoxScreen : public Screen
 	{
 	public:
-		LetterBoxScreen() : m_offset(0, 0), m_currentStrength(0), m_currentDirection(0) { Resize(c_designDimensions.x, c_designDimensions.y); }
+		LetterBoxScreen() : m_random(NULL), m_offset(0, 0), m_currentStrength(0), m_currentDirection(0) { Resize(c_designDimensions.x, c_designDimensions.y); }
 
 		virtual Point		ScreenToWindowSpace(const Point _screenPosition)	{ return (m_position + m_offset) + (_screenPosition * m_scale); }
 
@@ -41,6 +42,10 @@ namespace Screens
 		void				Update(Time::DeltaTime&);
 
 		void				Resize(int32_t, int32_t);
+
+		/// <summary> Sets the random stream used to shake the screen. </summary>
+		/// <param name="_random"> The random stream. </param>
+		inline void			SetRandomStream(Random::RandomStream& _random)		{ m_random = &_random; }
 	private:
 		/// <summary> The dimensions of the screen the game was designed for. </summary>
 		const Point		c_designDimensions = Point(960, 540);
@@ -54,6 +59,9 @@ namespace Screens
 		/// <summary> The multiplier of how much strength is lost per second while shaking. </summary>
 		const float_t	c_strengthDecay = 3.5f;
 
+		/// <summary> The random stream used to shake the screen. </summary>
+		Random::RandomStream* m_random;
+
 		/// <summary> The position of the screen. </summary>
 		Point			m_position;
 
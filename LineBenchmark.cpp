@@ -0,0 +1,93 @@
+#include "LineBenchmark.h"
+
+// Benchmark includes.
+#include "MapBenchmark.h"
+
+// Utility includes.
+#include "Random.h"
+#include <chrono>
+#include <iomanip>
+
+/// <summary> Covers every seeded line with both line functions, first checking that they agree, then timing each. </summary>
+/// <returns> The measurements of both functions over every line. </returns>
+Benchmarks::LineSample Benchmarks::LineBenchmark::Run() const
+{
+	LineSample sample = LineSample();
+	sample.m_lines = m_lines;
+
+	// Make the end points of every line before anything is measured.
+	Random::RandomStream random(m_seed);
+	std::vector<Point> endPoints(m_lines * 2);
+	for (size_t i = 0; i < endPoints.size(); i++) { endPoints[i] = Point(random.Between(0, m_range), random.Between(0, m_range)); }
+
+	// Check that both functions cover the same points in the same order.
+	for (uint32_t i = 0; i < m_lines; i++) { if (!isMatch(endPoints[i * 2], endPoints[i * 2 + 1])) { sample.m_mismatches++; } }
+
+	// Add up the covered points so that neither line can be optimised away.
+	int64_t vectorTotal = 0, visitorTotal = 0;
+
+	// Time the vector function.
+	uint64_t startAllocations = MapBenchmark::GetAllocationCount();
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+	for (uint32_t i = 0; i < m_lines; i++)
+	{
+		Point lineStart = endPoints[i * 2], lineEnd = endPoints[i * 2 + 1];
+		std::vector<Point> coveredPoints = Point::getCoveredPoints(Vector2(lineStart.x + 0.5f, lineStart.y + 0.5f), Vector2(lineEnd.x + 0.5f, lineEnd.y + 0.5f));
+		for (size_t p = 0; p < coveredPoints.size(); p++) { vectorTotal += coveredPoints[p].x + coveredPoints[p].y; }
+	}
+	sample.m_vectorTimeNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / m_lines;
+	sample.m_vectorAllocations = MapBenchmark::GetAllocationCount() - startAllocations;
+
+	// Time the visitor function.
+	startAllocations = MapBenchmark::GetAllocationCount();
+	start = std::chrono::high_resolution_clock::now();
+	for (uint32_t i = 0; i < m_lines; i++)
+	{
+		Point::visitCoveredPoints(endPoints[i * 2], endPoints[i * 2 + 1], [&visitorTotal](const Point _point) { visitorTotal += _point.x + _point.y; return true; });
+	}
+	sample.m_visitorTimeNS = std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / m_lines;
+	sample.m_visitorAllocations = MapBenchmark::GetAllocationCount() - startAllocations;
+
+	// If the totals differ, the functions covered different points.
+	if (vectorTotal != visitorTotal) { sample.m_mismatches++; }
+
+	return sample;
+}
+
+/// <summary> Writes the given sample as a header line followed by a value line. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_sample"> The sample to write. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::LineBenchmark::WriteSummary(std::ostream& _output, const LineSample& _sample, const bool _isCSV)
+{
+	const char* columns[] = { "lines", "vector_ns", "visitor_ns", "vector_allocs", "visitor_allocs", "mismatches" };
+	double_t values[] = { (double_t)_sample.m_lines, _sample.m_vectorTimeNS, _sample.m_visitorTimeNS, (double_t)_sample.m_vectorAllocations, (double_t)_sample.m_visitorAllocations, (double_t)_sample.m_mismatches };
+
+	for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++)
+	{
+		if (_isCSV) { _output << (i > 0 ? "," : "") << columns[i]; }
+		else { _output << std::setw(15) << columns[i]; }
+	}
+	_output << std::endl << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+	{
+		if (_isCSV) { _output << (i > 0 ? "," : "") << values[i]; }
+		else { _output << std::setw(15) << values[i]; }
+	}
+	_output << std::defaultfloat << std::endl;
+}
+
+/// <summary> Checks whether both line functions cover exactly the same points in the same order between the given cells. </summary>
+/// <param name="_start"> The start cell. </param>
+/// <param name="_end"> The end cell. </param>
+/// <returns> <c>true</c> if the covered points are the same; otherwise, <c>false</c>. </returns>
+bool Benchmarks::LineBenchmark::isMatch(const Point _start, const Point _end)
+{
+	std::vector<Point> expectedPoints = Point::getCoveredPoints(Vector2(_start.x + 0.5f, _start.y + 0.5f), Vector2(_end.x + 0.5f, _end.y + 0.5f));
+
+	// Compare each visited point to the expected point at the same index, stopping at the first difference.
+	size_t index = 0;
+	bool isVisitComplete = Point::visitCoveredPoints(_start, _end, [&expectedPoints, &index](const Point _point) { return index < expectedPoints.size() && expectedPoints[index++] == _point; });
+
+	return isVisitComplete && index == expectedPoints.size();
+}
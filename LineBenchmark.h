@@ -0,0 +1,65 @@
+#ifndef LINEBENCHMARK_H
+#define LINEBENCHMARK_H
+
+// Data includes.
+#include "Point.h"
+
+// Utility includes.
+#include <ostream>
+#include <vector>
+
+// Typedef includes.
+#include <cmath>
+#include <stdint.h>
+
+namespace Benchmarks
+{
+	/// <summary> Represents the cost of covering the same lines with both line functions of <see cref="Point"/>, and how often they disagreed. </summary>
+	struct LineSample
+	{
+		/// <summary> The amount of lines that were covered. </summary>
+		uint32_t	m_lines;
+
+		/// <summary> The mean time of <see cref="Point::getCoveredPoints"/> per line in nanoseconds. </summary>
+		double_t	m_vectorTimeNS;
+
+		/// <summary> The mean time of <see cref="Point::visitCoveredPoints"/> per line in nanoseconds. </summary>
+		double_t	m_visitorTimeNS;
+
+		/// <summary> How many allocations <see cref="Point::getCoveredPoints"/> made over every line. </summary>
+		uint64_t	m_vectorAllocations;
+
+		/// <summary> How many allocations <see cref="Point::visitCoveredPoints"/> made over every line. </summary>
+		uint64_t	m_visitorAllocations;
+
+		/// <summary> The amount of lines where the two functions did not cover exactly the same points in the same order. </summary>
+		uint32_t	m_mismatches;
+	};
+
+	/// <summary> Represents a benchmark that covers many seeded lines between cell centres with both line functions of <see cref="Point"/>, checking that they agree and measuring the cost of each. </summary>
+	class LineBenchmark
+	{
+	public:
+		/// <summary> Creates a new benchmark over the given amount of lines. </summary>
+		/// <param name="_lines"> The amount of lines to cover. </param>
+		/// <param name="_seed"> The seed of the end points of the lines. </param>
+		/// <param name="_range"> The largest position of an end point on each axis. </param>
+		LineBenchmark(const uint32_t _lines, const uint32_t _seed, const int32_t _range) : m_lines(_lines), m_seed(_seed), m_range(_range) {}
+
+		LineSample Run() const;
+
+		static void WriteSummary(std::ostream&, const LineSample&, bool);
+	private:
+		/// <summary> The amount of lines to cover. </summary>
+		uint32_t	m_lines;
+
+		/// <summary> The seed of the end points of the lines. </summary>
+		uint32_t	m_seed;
+
+		/// <summary> The largest position of an end point on each axis. </summary>
+		int32_t		m_range;
+
+		static bool isMatch(Point, Point);
+	};
+}
+#endif
@@ -1,9 +1,16 @@
 #include "MainMenu.h"
 
+// Service includes.
+#include "Graphics.h"
+
 /// <summary> Draws the menu. </summary>
 /// <param name="_services"> The service provider. </param>
 void UserInterface::MainMenu::Draw(Services::ServiceProvider& _services) const
 {
+	// Every part of the menu comes from the UI sheet, so it can all be batched together.
+	Graphics::Graphics& graphics = _services.GetService<Graphics::Graphics>(Services::ServiceType::Graphics);
+	graphics.BeginBatch();
+
 	// Draw the background first.
 	m_backgroundFrame.Draw(_services);
 
@@ -15,6 +22,8 @@ void UserInterface::MainMenu::Draw(Services::ServiceProvider& _services) const
 	m_helpButton.Draw(_services);
 	m_exitButton.Draw(_services);
 	m_backButton.Draw(_services);
+
+	graphics.EndBatch();
 }
 
 /// <summary> Binds events. </summary>
@@ -0,0 +1,165 @@
+#include "MapBenchmark.h"
+
+// Utility includes.
+#include "Random.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+/// <summary> The amount of allocations made since the program started. </summary>
+static std::atomic<uint64_t> s_allocationCount(0);
+
+// Replace the global allocation functions for the whole benchmark program, so that every allocation made by the generators is counted.
+void* operator new(const size_t _size)
+{
+	s_allocationCount++;
+	void* memory = std::malloc(_size == 0 ? 1 : _size);
+	if (memory == nullptr) { throw std::bad_alloc(); }
+	return memory;
+}
+void* operator new[](const size_t _size) { return operator new(_size); }
+void operator delete(void* _memory) noexcept { std::free(_memory); }
+void operator delete[](void* _memory) noexcept { std::free(_memory); }
+void operator delete(void* _memory, size_t) noexcept { std::free(_memory); }
+void operator delete[](void* _memory, size_t) noexcept { std::free(_memory); }
+
+/// <summary> Gets the amount of allocations made since the program started. </summary>
+/// <returns> The amount of allocations. </returns>
+uint64_t Benchmarks::MapBenchmark::GetAllocationCount()
+{
+	return s_allocationCount;
+}
+
+/// <summary> Generates the set amount of seeded maps of the given size, measuring each. </summary>
+/// <param name="_createGenerator"> Creates a new generator for each map, the same as the world does. </param>
+/// <param name="_size"> The width and height of each map. </param>
+/// <returns> The measurements of each map. </returns>
+std::vector<Benchmarks::MapSample> Benchmarks::MapBenchmark::Run(std::function<MapGeneration::MapGenerator*()> _createGenerator, const uint32_t _size)
+{
+	std::vector<MapSample> samples;
+	samples.reserve(m_runs);
+
+	// Reuse the same map for every run, the same as the world does.
+	WorldObjects::TileMap map(_size, _size);
+	for (uint32_t i = 0; i < m_runs; i++)
+	{
+		// Create the generator and a stream seeded for this run, so that each run makes the same map every time.
+		MapGeneration::MapGenerator* generator = _createGenerator();
+		GameObjects::MapObject spawn, exit;
+		Random::RandomStream random(m_seed + i);
+
+		// Take the allocation counter before generating, then generate the map and take the time.
+		uint64_t startAllocations = GetAllocationCount();
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		generator->Generate(map, random, spawn, exit);
+		double_t timeMS = std::chrono::duration<double_t, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		uint64_t allocations = GetAllocationCount() - startAllocations;
+		delete generator;
+
+		// Measure the output, then add the cost.
+		MapSample sample = measureOutput(map);
+		sample.m_timeMS = timeMS;
+		sample.m_allocations = allocations;
+		sample.m_randomCalls = random.GetCallCount();
+		samples.push_back(sample);
+	}
+
+	return samples;
+}
+
+/// <summary> Writes the names of each column of the summaries. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::MapBenchmark::WriteHeader(std::ostream& _output, const bool _isCSV)
+{
+	const char* columns[] = { "generator", "size", "runs", "mean_ms", "p50_ms", "p90_ms", "p99_ms", "max_ms", "allocs", "rng_calls", "floor_ratio", "dead_ends", "prosperity" };
+	for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++)
+	{
+		if (_isCSV) { _output << (i > 0 ? "," : "") << columns[i]; }
+		else { _output << std::setw(i == 0 ? 10 : 12) << columns[i]; }
+	}
+	_output << std::endl;
+}
+
+/// <summary> Writes the averages and time percentiles of the given samples on one line. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_generatorName"> The name of the generator. </param>
+/// <param name="_size"> The width and height of the maps. </param>
+/// <param name="_samples"> The samples to summarise. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::MapBenchmark::WriteSummary(std::ostream& _output, const std::string& _generatorName, const uint32_t _size, std::vector<MapSample> _samples, const bool _isCSV)
+{
+	// If there are no samples, there is nothing to summarise.
+	if (_samples.empty()) { return; }
+
+	// Add up every sample, keeping the times so that they can be sorted for the percentiles.
+	std::vector<double_t> times;
+	double_t totalTime = 0, totalAllocations = 0, totalRandomCalls = 0, totalFloorRatio = 0, totalDeadEnds = 0, totalProsperity = 0;
+	for (size_t i = 0; i < _samples.size(); i++)
+	{
+		times.push_back(_samples[i].m_timeMS);
+		totalTime += _samples[i].m_timeMS;
+		totalAllocations += _samples[i].m_allocations;
+		totalRandomCalls += _samples[i].m_randomCalls;
+		totalFloorRatio += _samples[i].m_floorRatio;
+		totalDeadEnds += _samples[i].m_deadEnds;
+		totalProsperity += _samples[i].m_prosperity;
+	}
+	std::sort(times.begin(), times.end());
+	double_t amount = (double_t)_samples.size();
+
+	// Write each column.
+	double_t values[] = { totalTime / amount, getPercentile(times, 0.5), getPercentile(times, 0.9), getPercentile(times, 0.99), times.back(), totalAllocations / amount, totalRandomCalls / amount, totalFloorRatio / amount, totalDeadEnds / amount, totalProsperity / amount };
+	if (_isCSV) { _output << _generatorName << ',' << _size << ',' << _samples.size(); }
+	else { _output << std::setw(10) << _generatorName << std::setw(12) << _size << std::setw(12) << _samples.size(); }
+	_output << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+	{
+		if (_isCSV) { _output << ',' << values[i]; }
+		else { _output << std::setw(12) << values[i]; }
+	}
+	_output << std::defaultfloat << std::endl;
+}
+
+/// <summary> Measures the floor, dead ends, and prosperity of the given map. </summary>
+/// <param name="_map"> The generated map. </param>
+/// <returns> A sample with the output measurements filled in. </returns>
+Benchmarks::MapSample Benchmarks::MapBenchmark::measureOutput(const WorldObjects::TileMap& _map)
+{
+	WorldObjects::TileMap::View view = _map.GetView();
+	MapSample sample = MapSample();
+
+	uint64_t floorCount = 0;
+	view.VisitTiles(Rectangle(0, 0, (int32_t)view.GetWidth(), (int32_t)view.GetHeight()), [&view, &sample, &floorCount](const Point _position, const WorldObjects::Tile _tile)
+	{
+		sample.m_prosperity += _tile.m_prosperity;
+
+		// Only floor can be counted towards the floor and dead ends.
+		if (!SpriteData::IsFloor(_tile.m_ID)) { return; }
+		floorCount++;
+
+		// Count the directly adjacent floor, a dead end has only one.
+		uint8_t adjacentFloor = 0;
+		if (view.IsCellClearAndInRange(Point(_position.x - 1, _position.y))) { adjacentFloor++; }
+		if (view.IsCellClearAndInRange(Point(_position.x + 1, _position.y))) { adjacentFloor++; }
+		if (view.IsCellClearAndInRange(Point(_position.x, _position.y - 1))) { adjacentFloor++; }
+		if (view.IsCellClearAndInRange(Point(_position.x, _position.y + 1))) { adjacentFloor++; }
+		if (adjacentFloor == 1) { sample.m_deadEnds++; }
+	});
+
+	sample.m_floorRatio = (double_t)floorCount / view.GetArea();
+	return sample;
+}
+
+/// <summary> Gets the value at the given percentile of the given sorted values, using the nearest rank. </summary>
+/// <param name="_sortedValues"> The values, sorted from lowest to highest. </param>
+/// <param name="_percentile"> The percentile from <c>0</c> to <c>1</c>. </param>
+/// <returns> The value at the percentile. </returns>
+double_t Benchmarks::MapBenchmark::getPercentile(const std::vector<double_t>& _sortedValues, const double_t _percentile)
+{
+	size_t rank = (size_t)ceil(_percentile * _sortedValues.size());
+	return _sortedValues[std::min(std::max(rank, (size_t)1), _sortedValues.size()) - 1];
+}
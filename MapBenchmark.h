@@ -0,0 +1,69 @@
+#ifndef MAPBENCHMARK_H
+#define MAPBENCHMARK_H
+
+// Generation includes.
+#include "MapGenerator.h"
+
+// Utility includes.
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Typedef includes.
+#include <cmath>
+#include <stdint.h>
+
+namespace Benchmarks
+{
+	/// <summary> Represents the cost and output of generating a single map. </summary>
+	struct MapSample
+	{
+		/// <summary> How long the generation took in milliseconds. </summary>
+		double_t	m_timeMS;
+
+		/// <summary> How many allocations were made while generating. </summary>
+		uint64_t	m_allocations;
+
+		/// <summary> How many random values were made while generating. </summary>
+		uint64_t	m_randomCalls;
+
+		/// <summary> The fraction of the map that is floor, from <c>0</c> to <c>1</c>. </summary>
+		double_t	m_floorRatio;
+
+		/// <summary> The amount of floor cells with exactly one floor neighbour. </summary>
+		uint32_t	m_deadEnds;
+
+		/// <summary> The total prosperity of every cell. </summary>
+		uint64_t	m_prosperity;
+	};
+
+	/// <summary> Represents a benchmark that generates many seeded maps of each size with a generator, measuring the cost and the output of each. </summary>
+	class MapBenchmark
+	{
+	public:
+		/// <summary> Creates a new benchmark that generates the given amount of maps per size, starting from the given seed. </summary>
+		/// <param name="_runs"> The amount of maps to generate for each size. </param>
+		/// <param name="_seed"> The seed of the first map, each following map uses the next seed. </param>
+		MapBenchmark(const uint32_t _runs, const uint32_t _seed) : m_runs(_runs), m_seed(_seed) {}
+
+		std::vector<MapSample> Run(std::function<MapGeneration::MapGenerator*()>, uint32_t);
+
+		static void WriteHeader(std::ostream&, bool);
+
+		static void WriteSummary(std::ostream&, const std::string&, uint32_t, std::vector<MapSample>, bool);
+
+		static uint64_t GetAllocationCount();
+	private:
+		/// <summary> The amount of maps to generate for each size. </summary>
+		uint32_t m_runs;
+
+		/// <summary> The seed of the first map. </summary>
+		uint32_t m_seed;
+
+		static MapSample measureOutput(const WorldObjects::TileMap&);
+
+		static double_t getPercentile(const std::vector<double_t>&, double_t);
+	};
+}
+#endif
@@ -7,19 +7,37 @@
 // Game object includes.
 #include "MapObject.h"
 
+// Utility includes.
+#include "Random.h"
+#include <atomic>
+
 namespace MapGeneration
 {
 	/// <summary> Represents an interfaced version of a map generator that just allows for a map to be generated. </summary>
 	class MapGenerator
 	{
 	public:
+		MapGenerator() : m_cancelFlag(NULL) {}
+
 		virtual ~MapGenerator() {}
 
+		/// <summary> Sets the flag that, once set, makes the generator stop as soon as it can, leaving the map unfinished. </summary>
+		/// <param name="_cancelFlag"> The flag, which is only ever read. </param>
+		inline void SetCancelFlag(const std::atomic<bool>& _cancelFlag) { m_cancelFlag = &_cancelFlag; }
+
 		/// <summary> Generates a map on the given tile map, using the given spawn and exit game objects as part of the map. </summary>
 		/// <param name="_map"> The map data. </param>
+		/// <param name="_random"> The random stream to draw from, so that the same seed always makes the same map. </param>
 		/// <param name="_spawn"> The spawn object. </param>
 		/// <param name="_exit"> The exit object. </param>
-		virtual void Generate(WorldObjects::TileMap& _map, GameObjects::MapObject& _spawn, GameObjects::MapObject& _exit) = 0;
+		virtual void Generate(WorldObjects::TileMap& _map, Random::RandomStream& _random, GameObjects::MapObject& _spawn, GameObjects::MapObject& _exit) = 0;
+	protected:
+		/// <summary> Finds if the generation has been cancelled. </summary>
+		/// <returns> <c>true</c> if the generator should stop; otherwise, <c>false</c>. </returns>
+		inline bool isCancelled() const { return m_cancelFlag != NULL && m_cancelFlag->load(std::memory_order_relaxed); }
+	private:
+		/// <summary> The flag that cancels the generation when set, or <c>NULL</c> if it cannot be cancelled. </summary>
+		const std::atomic<bool>* m_cancelFlag;
 	};
 }
 #endif
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "MinigameMenu.h"
 
+// Service includes.
+#include "Graphics.h"
+
 // Utility includes.
 #include "SpriteData.h"
 
@@ -43,9 +46,15 @@ void UserInterface::MinigameMenu::Initialise(const uint16_t _maxTimer, Events::E
 /// <param name="_services"> The service provider. </param>
 void UserInterface::MinigameMenu::Draw(Services::ServiceProvider& _services) const
 {
+	// Every part of the menu comes from the UI sheet, so it can all be batched together.
+	Graphics::Graphics& graphics = _services.GetService<Graphics::Graphics>(Services::ServiceType::Graphics);
+	graphics.BeginBatch();
+
 	m_bottomBar.Draw(_services);
 	m_collapseBar.Draw(_services);
 	for (uint8_t i = 0; i < 3; i++) { m_toolButtons[i].Draw(_services); }
+
+	graphics.EndBatch();
 }
 
 /// <summary> Fires when the wall is mined, updates the progress bar. </summary>
@@ -38,7 +38,7 @@ namespace UserInterface
 
 		/// <summary> Fires when the current tool is changed, hides the tool's button. </summary>
 		/// <param name="_context"> The context of the event. </param>
-		void toolChanged(Events::EventContext* _context) { for (uint8_t i = 0; i < 3; i++) { m_toolButtons[i].SetActive(*static_cast<uint8_t*>(_context->m_data1) != i); } }
+		void toolChanged(Events::EventContext* _context) { for (uint8_t i = 0; i < 3; i++) { m_toolButtons[i].SetActive(*static_cast<int32_t*>(_context->m_data1) != i); } }
 
 		void wallMined(Events::EventContext*);
 
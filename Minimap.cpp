@@ -24,28 +24,9 @@ void UserInterface::Minimap::Draw(WorldObjects::World& _world, Services::Service
 	float_t tileWidth = (float_t)m_bounds.w / tileMap.GetWidth();
 	float_t tileHeight = (float_t)m_bounds.h / tileMap.GetHeight();
 
-	// Go over every tile in the map.
-	for (uint8_t x = 0; x < tileMap.GetWidth(); x++)
-	{
-		for (uint8_t y = 0; y < tileMap.GetHeight(); y++)
-		{
-			// If the tile is not visible, skip it.
-			if (!tileMap.GetTileAt(Point(x, y)).m_visibility) { continue; }
-
-			// Calculate the sprite ID.
-			uint16_t spriteID = 0;
-			if (tileMap.IsCellBlocked(Point(x, y))) 
-			{
-				spriteID = (tileMap.GetTileAt(Point(x, y)).m_prosperity > 0) ? SpriteData::MinimapID::LowProsp + (tileMap.GetTileAt(Point(x, y)).m_prosperity / 64) : SpriteData::MinimapID::PlainWall;
-			}
-			else { spriteID = SpriteData::MinimapID::PlainFloor; }
-
-			// Calculate the window bounds.
-			Rectangle windowBounds = screen.ScreenToWindowBounds(Rectangle(Point(x * tileWidth, y * tileHeight) + Point(m_bounds.x, m_bounds.y), Point(ceil(tileWidth), ceil(tileHeight))));
-
-			graphics.Draw(SpriteData::SheetID::Minimap, spriteID, windowBounds);
-		}
-	}
+	// Rewrite any tiles that have changed, then draw every tile at once.
+	updateCanvas(_world, graphics);
+	graphics.DrawCanvas(SpriteData::CanvasID::MinimapTiles, screen.ScreenToWindowBounds(m_bounds));
 
 	// Draw the spawn.
 	Rectangle windowBounds = screen.ScreenToWindowBounds(Rectangle(Point(_world.GetSpawn().GetTilePosition().x * tileWidth, _world.GetSpawn().GetTilePosition().y * tileHeight) + Point(m_bounds.x, m_bounds.y), Point(ceil(tileWidth), ceil(tileHeight))));
@@ -59,3 +40,49 @@ void UserInterface::Minimap::Draw(WorldObjects::World& _world, Services::Service
 	windowBounds = screen.ScreenToWindowBounds(Rectangle(Point(_world.GetPlayer().GetTilePosition().x * tileWidth, _world.GetPlayer().GetTilePosition().y * tileHeight) + Point(m_bounds.x, m_bounds.y), Point(ceil(tileWidth), ceil(tileHeight))));
 	graphics.Draw(SpriteData::SheetID::Minimap, SpriteData::MinimapID::Player, windowBounds);
 }
+
+/// <summary> Rewrites the pixels of every tile that has changed since the last update, creating the canvas if it does not yet exist. </summary>
+/// <param name="_world"> The world. </param>
+/// <param name="_graphics"> The graphics service. </param>
+void UserInterface::Minimap::updateCanvas(WorldObjects::World& _world, Graphics::Graphics& _graphics)
+{
+	// Get the tile map to register with, and a view of it to read the tiles of each region.
+	WorldObjects::IReadOnlyTileMap& tileMap = _world.GetTileMap();
+	WorldObjects::TileMap::View tileView = _world.GetTileMapView();
+
+	// If the canvas has not yet been made, make it with one pixel per tile and start taking changes from the map, which starts with the whole map changed.
+	if (!m_hasCanvas)
+	{
+		_graphics.CreateCanvas(SpriteData::CanvasID::MinimapTiles, Point((int32_t)tileMap.GetWidth(), (int32_t)tileMap.GetHeight()));
+		m_dirtyConsumerID = tileMap.RegisterDirtyConsumer();
+		m_hasCanvas = true;
+	}
+
+	// Go over each changed region, working out the colour of each tile and writing the region to the canvas in one go.
+	std::vector<Rectangle> dirtyRegions = tileMap.ConsumeDirtyRegions(m_dirtyConsumerID);
+	for (size_t i = 0; i < dirtyRegions.size(); i++)
+	{
+		Rectangle region = dirtyRegions[i];
+		m_regionPixels.resize(region.w * region.h);
+
+		tileView.VisitTiles(region, [this, &region, &_graphics](const Point _position, const WorldObjects::Tile _tile)
+		{
+			// If the tile is not visible, leave it transparent.
+			Graphics::Colour& pixel = m_regionPixels[(_position.y - region.y) * region.w + (_position.x - region.x)];
+			if (!_tile.m_visibility) { pixel = Graphics::Colour{ 0, 0, 0, 0 }; return; }
+
+			// Calculate the sprite ID.
+			uint16_t spriteID = 0;
+			if (SpriteData::IsWall(_tile.m_ID))
+			{
+				spriteID = (_tile.m_prosperity > 0) ? SpriteData::MinimapID::LowProsp + (_tile.m_prosperity / 64) : SpriteData::MinimapID::PlainWall;
+			}
+			else { spriteID = SpriteData::MinimapID::PlainFloor; }
+
+			// Use the colour of the sprite as the colour of the tile.
+			pixel = _graphics.GetSpriteColour(SpriteData::SheetID::Minimap, spriteID);
+		});
+
+		_graphics.SetCanvasPixels(SpriteData::CanvasID::MinimapTiles, region, m_regionPixels.data());
+	}
+}
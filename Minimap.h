@@ -6,22 +6,42 @@
 
 // Data includes.
 #include "Rectangle.h"
+#include "Colour.h"
+
+// Utility includes.
+#include <vector>
+
+// Typedef includes.
+#include <stdint.h>
 
 // Forward declaration.
 namespace WorldObjects { class World; }
+namespace Graphics { class Graphics; }
 
 namespace UserInterface
 {
+	/// <summary> Represents a map of the world, kept as a canvas with one pixel per tile that is only rewritten where tiles change. </summary>
 	class Minimap
 	{
 	public:
-		Minimap() : m_bounds(Rectangle(0, 0, 0, 0)) {}
-		Minimap(const Rectangle _bounds) : m_bounds(_bounds) {}
+		Minimap() : m_bounds(Rectangle(0, 0, 0, 0)), m_hasCanvas(false), m_dirtyConsumerID(0), m_regionPixels() {}
+		Minimap(const Rectangle _bounds) : m_bounds(_bounds), m_hasCanvas(false), m_dirtyConsumerID(0), m_regionPixels() {}
 
 		void Draw(WorldObjects::World&, Services::ServiceProvider&);
 	private:
 		/// <summary> The bounds of the minimap on the screen. </summary>
-		Rectangle m_bounds;
+		Rectangle						m_bounds;
+
+		/// <summary> <c>true</c> if the canvas has been created and this is registered for the changes to the map; otherwise, <c>false</c>. </summary>
+		bool							m_hasCanvas;
+
+		/// <summary> The ID given by the map with which to take its changes. </summary>
+		uint32_t						m_dirtyConsumerID;
+
+		/// <summary> The pixels of the region currently being rewritten, kept to avoid allocating each frame. </summary>
+		std::vector<Graphics::Colour>	m_regionPixels;
+
+		void updateCanvas(WorldObjects::World&, Graphics::Graphics&);
 	};
 }
 #endif
\ No newline at end of file
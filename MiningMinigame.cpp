@@ -14,8 +14,9 @@
 #include "Rectangle.h"
 
 // Utility includes.
-#include "Random.h"
+#include "RandomService.h"
 #include "AudioData.h"
+#include <algorithm>
 
 /// <summary> Sets up event bindings and the UI. </summary>
 /// <param name="_events"> The events bus. </param>
@@ -35,7 +36,7 @@ void Minigames::MiningMinigame::Initialise(Events::Events& _events)
 	m_minigameMenu.Initialise(c_maxTimer, _events);
 
 	// Change the tool to the first one.
-	_events.PushEvent(Events::UserEvent::ChangeTool, new uint8_t(0), NULL);
+	_events.PushEvent(Events::UserEvent::ChangeTool, new int32_t(0), NULL);
 }
 
 /// <summary> Draws the minigame and the UI. </summary>
@@ -46,27 +47,29 @@ void Minigames::MiningMinigame::Draw(Services::ServiceProvider& _services)
 	Graphics::Graphics& graphics = _services.GetService<Graphics::Graphics>(Services::ServiceType::Graphics);
 	Screens::Screen& screen = _services.GetService<Screens::Screen>(Services::ServiceType::Screen);
 
-	// Extremely inefficient, but time restrictions prevent me from making any optimised algorithm.
-	// If I were to have more time, I would implement a data structure to hold each layer separately.
+	// The size of each cell of rock on the window.
+	Point wallSize = screen.ScreenToWindowSize(Point(SpriteData::c_wallSize));
+
+	// Draw each layer from the back, so the cost only depends on the amount of cells and gems. The gems are sorted by layer, so they are walked once alongside the layers.
+	uint32_t gemIndex = 0;
 	for (uint8_t l = 0; l < m_wallData.c_maxValue; l++)
 	{
-		// Draw all gems on this layer.
-		for (uint32_t g = 0; g < m_wallGems.size(); g++) { if (m_wallGems[g].GetLayer() == l) { m_wallGems[g].Draw(_services); } }
+		// Draw all gems on this layer that have not been mined.
+		for (; gemIndex < m_wallGems.size() && m_wallGems[gemIndex].GetLayer() == l; gemIndex++) { if (m_coveredCellCounts[gemIndex] > 0) { m_wallGems[gemIndex].Draw(_services); } }
+
+		// If there is no rock on this layer, there is nothing more to draw.
+		const std::vector<uint16_t>& layerCells = m_wallData.GetLayerCells(l);
+		if (layerCells.empty()) { continue; }
 
-		// Draw rock on this layer.
-		for (int32_t x = 0; x < m_wallData.GetWidth(); x++)
+		// Draw rock on this layer, batched together so that it is submitted after the gems beneath it.
+		graphics.BeginBatch();
+		for (size_t i = 0; i < layerCells.size(); i++)
 		{
-			for (int32_t y = 0; y < m_wallData.GetHeight(); y++)
-			{
-				// If this is the layer to be drawn.
-				if (m_wallData.GetValueAt(x, y) == l)
-				{
-					// Calculate the window position and draw.
-					Point windowPosition = screen.ScreenToWindowSpace(Point(x, y) * SpriteData::c_wallSize);
-					graphics.Draw(SpriteData::SheetID::MineWalls, l, Rectangle(windowPosition, screen.ScreenToWindowSize(Point(SpriteData::c_wallSize))));
-				}
-			}
+			// Calculate the window position and draw.
+			Point windowPosition = screen.ScreenToWindowSpace(m_wallData.GetCellPosition(layerCells[i]) * SpriteData::c_wallSize);
+			graphics.Draw(SpriteData::SheetID::MineWalls, l, Rectangle(windowPosition, wallSize));
 		}
+		graphics.EndBatch();
 	}
 
 	// Draw the UI.
@@ -79,16 +82,15 @@ void Minigames::MiningMinigame::Draw(Services::ServiceProvider& _services)
 void Minigames::MiningMinigame::Prepare(Services::ServiceProvider& _services, const Point _tilePosition, const uint8_t _prosperity)
 {
 	// Start on the first tool.
-	_services.GetService<Events::Events>(Services::ServiceType::Events).PushEvent(Events::UserEvent::ChangeTool, new uint8_t(0), NULL);
+	_services.GetService<Events::Events>(Services::ServiceType::Events).PushEvent(Events::UserEvent::ChangeTool, new int32_t(0), NULL);
 
 	// Set the tile position.
 	m_tilePosition = _tilePosition;
 
-	// Generate the wall.
-	m_wallData.Generate();
-
-	// Place the gems.
-	placeGems(_prosperity);
+	// Generate the wall and place the gems from the generation stream.
+	Random::RandomStream& random = _services.GetService<Random::RandomService>(Services::ServiceType::Random).GetStream(Random::StreamType::Generation);
+	m_wallData.Generate(random);
+	placeGems(_prosperity, random);
 
 	// Reset the collapse timer.
 	m_collapseTimer = c_maxTimer;
@@ -102,7 +104,7 @@ void Minigames::MiningMinigame::changeTool(Events::EventContext* _context)
 	if (_context->m_gameState != MainGame::GameState::Minigame) { return; }
 
 	// Set the current tool ID to the given ID.
-	m_currentToolID = *static_cast<uint8_t*>(_context->m_data1);
+	m_currentToolID = (uint8_t)*static_cast<int32_t*>(_context->m_data1);
 }
 
 /// <summary> Handles the player pressing a key to change tool. </summary>
@@ -122,9 +124,9 @@ void Minigames::MiningMinigame::hotkeyTool(Events::EventContext* _context)
 	// Push a change tool event instead of manually changing the tool, so that the function can be reused and anything that's listening for the change tool event can also change.
 	switch (scancode)
 	{
-	case SDL_SCANCODE_1: { events.PushEvent(Events::UserEvent::ChangeTool, new uint8_t(0), NULL); break; }
-	case SDL_SCANCODE_2: { events.PushEvent(Events::UserEvent::ChangeTool, new uint8_t(1), NULL); break; }
-	case SDL_SCANCODE_3: { events.PushEvent(Events::UserEvent::ChangeTool, new uint8_t(2), NULL); break; }
+	case SDL_SCANCODE_1: { events.PushEvent(Events::UserEvent::ChangeTool, new int32_t(0), NULL); break; }
+	case SDL_SCANCODE_2: { events.PushEvent(Events::UserEvent::ChangeTool, new int32_t(1), NULL); break; }
+	case SDL_SCANCODE_3: { events.PushEvent(Events::UserEvent::ChangeTool, new int32_t(2), NULL); break; }
 	}
 }
 
@@ -144,58 +146,52 @@ void Minigames::MiningMinigame::mineAt(Events::EventContext* _context)
 	// If the tile position is not in range, do nothing.
 	if (!m_wallData.IsInRange(tilePosition)) { return; }
 
-	// Store if a gem was hit.
+	// Store if a gem was hit, and how much the timer should go down.
 	bool didHitGem = false;
-
-	// Get the size and damage of the current tool.
-	uint8_t currentToolSize = s_tools[m_currentToolID].m_size;
-	uint8_t currentToolDamage = s_tools[m_currentToolID].m_power;
-
-	// Go over each tile covered by this area, and damage it.
-	for (int32_t x = std::max(0, tilePosition.x - (currentToolSize / 2)); x < std::min(m_wallData.GetWidth(), (uint8_t)( tilePosition.x + (currentToolSize / 2) + 1)); x++)
+	uint32_t timerDamage = 0;
+
+	// Clip the area of the current tool to the wall.
+	const Tool& currentTool = s_tools[m_currentToolID];
+	Point toolStart = tilePosition - Point(currentTool.m_size / 2);
+	Point stampStart(std::max(0, toolStart.x), std::max(0, toolStart.y));
+	Point stampEnd(std::min((int32_t)m_wallData.GetWidth(), toolStart.x + currentTool.m_size), std::min((int32_t)m_wallData.GetHeight(), toolStart.y + currentTool.m_size));
+
+	// Stamp the damage of the tool onto each tile covered by its area.
+	m_damagedCells.clear();
+	const uint8_t* wallValues = m_wallData.GetValues();
+	for (int32_t y = stampStart.y; y < stampEnd.y; y++)
 	{
-		for (int32_t y = std::max(0, tilePosition.y - (currentToolSize / 2)); y < std::min(m_wallData.GetHeight(), (uint8_t)(tilePosition.y + (currentToolSize / 2) + 1)); y++)
+		for (int32_t x = stampStart.x; x < stampEnd.x; x++)
 		{
-			// Get the largest distance from the centre.
-			uint8_t largestDistance = std::abs(x - tilePosition.x) + std::abs(y - tilePosition.y);
-
-			// Calculate the damage that should be dealt, and the damage that can be dealt.
-			uint8_t desiredDamage = std::max(0, currentToolDamage - largestDistance);
-			uint8_t damageDealt = std::min(m_wallData.GetValueAt(x, y), desiredDamage);
-
-			// If the desired damage is 0, skip the damage part.
+			// If the tool does no damage here, skip this tile.
+			uint8_t desiredDamage = currentTool.GetDamageAt(x - toolStart.x, y - toolStart.y);
 			if (desiredDamage == 0) { continue; }
 
-			// Find if a gem was hit. Stupidly inefficient, but the only way to do this without devoting more time to data structures.
-			WallGem* hitGem = NULL;
-			for (uint32_t g = 0; g < m_wallGems.size(); g++)
-			{
-				if (m_wallGems[g].GetLayer() > m_wallData.GetValueAt(x, y) && m_wallGems[g].CollidesWith(Point(x, y))) { hitGem = &m_wallGems[g]; break; }
-			}
-
-			// If a gem is hit, collapse a certain amount; otherwise, damage the wall.
-			if (hitGem != NULL)
+			// Find if a gem was hit, which is if the rock of this cell is below the top gem. If it is not, it is not below any gem beneath the top one either.
+			uint32_t cellIndex = y * m_wallData.GetWidth() + x;
+			uint8_t value = wallValues[cellIndex];
+			if (m_gemCells[cellIndex].m_layer > value)
 			{
-				// Subtract a set amount from the timer.
-				m_collapseTimer = std::max(0, m_collapseTimer - 15);
-
-				// A gem was hit, so keep track of it.
+				// Subtract a set amount from the timer, and keep track of the hit.
+				timerDamage += 15;
 				didHitGem = true;
+				continue;
 			}
-			else
-			{
-				// Subtract any over-damage from the timer, awarding precise hits and punishing hitting the back wall.
-				m_collapseTimer = std::max(0, m_collapseTimer - std::max(1, (desiredDamage - damageDealt)));
 
-				// Damage this tile.
-				m_wallData.SetValueAt(x, y, m_wallData.GetValueAt(x, y) - damageDealt);
+			// Take the damage away from the tile without going below 0, subtracting any over-damage from the timer, awarding precise hits and punishing hitting the back wall.
+			uint8_t newValue = (value > desiredDamage) ? value - desiredDamage : 0;
+			timerDamage += std::max(1, desiredDamage - (value - newValue));
+			setWallValue(Point(x, y), newValue);
 
-				// Create particles.
-				_context->m_services->GetService<Particles::ParticleManager>(Services::ServiceType::Particles).AddParticles(Point(x, y) * SpriteData::c_wallSize, 5, SpriteData::ParticleID::WallStart, SpriteData::ParticleID::WallEnd);
-			}
+			// Keep track of the tile for particles.
+			m_damagedCells.push_back(Point(x, y) * SpriteData::c_wallSize);
 		}
 	}
 
+	// Take the damage from the timer, and create the particles of every damaged tile at once.
+	m_collapseTimer = (uint16_t)std::max(0, (int32_t)m_collapseTimer - (int32_t)timerDamage);
+	_context->m_services->GetService<Particles::ParticleManager>(Services::ServiceType::Particles).AddParticles(m_damagedCells, 5, SpriteData::ParticleID::WallStart, SpriteData::ParticleID::WallEnd);
+
 	// Play a sound based on if a gem was hit.
 	Audio::Audio& audio = _context->m_services->GetService<Audio::Audio>(Services::ServiceType::Audio);
 	if (didHitGem) { audio.PlaySound(AudioData::SoundID::HitGem); }
@@ -215,17 +211,19 @@ void Minigames::MiningMinigame::mined(Events::EventContext* _context)
 	// Get the events service.
 	Events::Events& events = _context->m_services->GetService<Events::Events>(Services::ServiceType::Events);
 
-	// Remove any uncovered gems and award them to the player.
-	std::vector<WallGem>::iterator gemIter = m_wallGems.begin();
-	while (gemIter != m_wallGems.end())
+	// Award the gems that were uncovered by the last hit to the player, in the order they are in the wall.
+	if (!m_uncoveredGems.empty())
 	{
-		if (gemIter->IsFullyUncovered(m_wallData)) 
+		std::sort(m_uncoveredGems.begin(), m_uncoveredGems.end());
+		for (size_t i = 0; i < m_uncoveredGems.size(); i++)
 		{
-			events.PushEvent(Events::UserEvent::MinedGem, new WallGem(*gemIter), NULL);
+			events.PushEvent(Events::UserEvent::MinedGem, new WallGem(m_wallGems[m_uncoveredGems[i]]), NULL);
 			_context->m_services->GetService<Audio::Audio>(Services::ServiceType::Audio).PlaySound(AudioData::SoundID::GetGem);
-			gemIter = m_wallGems.erase(gemIter);
 		}
-		else { gemIter++; }
+		m_uncoveredGems.clear();
+
+		// The mined gems can no longer be hit, so find the top gem of each cell again.
+		buildGemCells();
 	}
 
 	// Collapse if collapse timer is 0.
@@ -234,54 +232,99 @@ void Minigames::MiningMinigame::mined(Events::EventContext* _context)
 
 /// <summary> Places gems into the wall based on the given prosperity. </summary>
 /// <param name="_prosperity"> A number from <c>0</c> to <c>255</c> for the prosperity of the wall. </param>
-void Minigames::MiningMinigame::placeGems(const uint8_t _prosperity)
+/// <param name="_random"> The random stream to draw from. </param>
+void Minigames::MiningMinigame::placeGems(const uint8_t _prosperity, Random::RandomStream& _random)
 {
 	// Clear the gem list.
 	m_wallGems.clear();
 
-	// Start with the given prosperity.
-	uint32_t remainingProsperity = (_prosperity + Random::RandomBetween(50, 100)) * 300;
+	// Place gems worth the given prosperity, plus some extra.
+	m_gemPlacer.Place(m_wallData, (_prosperity + _random.Between(50, 100)) * 300, _random, m_wallGems);
+
+	// Sort the gems by layer so that they can be drawn alongside the rock in one pass, removing gems keeps this order.
+	std::stable_sort(m_wallGems.begin(), m_wallGems.end(), [](const WallGem& _first, const WallGem& _second) { return _first.GetLayer() < _second.GetLayer(); });
+
+	// Count the cells covering each gem, then find the top gem of each cell for hit testing.
+	buildGemCoverage();
+	buildGemCells();
+}
 
-	// Keep placing gems until no prosperity remains.
-	while (remainingProsperity > 0)
+/// <summary> Counts the cells covering each gem, and groups the gems by the cells that cover them so that mining a cell only touches its own gems. </summary>
+void Minigames::MiningMinigame::buildGemCoverage()
+{
+	m_coveredCellCounts.assign(m_wallGems.size(), 0);
+	m_uncoveredGems.clear();
+
+	// Count the gems covered by each cell, then turn the counts into offsets, with each cell ending where the next starts.
+	m_cellGemOffsets.assign(m_wallData.GetWidth() * m_wallData.GetHeight() + 1, 0);
+	for (uint16_t g = 0; g < m_wallGems.size(); g++)
 	{
-		// Keep track of the validity of the gem as well as the gem itself.
-		WallGem gem(Point(0), 0, SpriteData::GemID::Ruby);
-		bool isValid = false;
+		m_wallGems[g].VisitCoverCells([this](const Point _position) { if (m_wallData.IsInRange(_position)) { m_cellGemOffsets[_position.y * m_wallData.GetWidth() + _position.x + 1]++; } });
+	}
+	for (size_t i = 1; i < m_cellGemOffsets.size(); i++) { m_cellGemOffsets[i] += m_cellGemOffsets[i - 1]; }
 
-		// Keep attempting to place a gem until a place is found.
-		do
+	// Put each gem into the cells that cover it, using the start of each cell as a cursor, which leaves it at the start of the next cell.
+	m_cellGems.resize(m_cellGemOffsets.back());
+	for (uint16_t g = 0; g < m_wallGems.size(); g++)
+	{
+		const uint8_t layer = m_wallGems[g].GetLayer();
+		m_wallGems[g].VisitCoverCells([this, g, layer](const Point _position)
 		{
-			// Generate a random ID and layer for the gem.
-			SpriteData::GemID gemID = (SpriteData::GemID)Random::RandomBetween(0, SpriteData::GemID::Emerald);
-			uint8_t layer = Random::RandomBetween(1, m_wallData.c_maxValue);
+			if (!m_wallData.IsInRange(_position)) { return; }
 
-			// Create the gem.
-			gem = WallGem(Point(0), layer, gemID);
+			// Add the gem to the cell, and count the cell if it covers the gem.
+			m_cellGems[m_cellGemOffsets[_position.y * m_wallData.GetWidth() + _position.x]++] = g;
+			if (m_wallData.GetValueAt(_position) >= layer) { m_coveredCellCounts[g]++; }
+		});
+	}
 
-			// Create a random position for the gem.
-			Point position(Random::RandomBetween(0, m_wallData.GetWidth() - gem.GetWidth()), Random::RandomBetween(0, m_wallData.GetHeight() - gem.GetHeight()));
-			gem.SetWallPosition(position);
+	// Move the offsets back by one cell, since each cursor has ended at the start of the next cell.
+	for (size_t i = m_cellGemOffsets.size() - 1; i > 0; i--) { m_cellGemOffsets[i] = m_cellGemOffsets[i - 1]; }
+	m_cellGemOffsets[0] = 0;
+}
 
-			// If the gem is uncovered straight away, it is invalid.
-			isValid = gem.IsFullyCovered(m_wallData);
+/// <summary> Lowers the cell of the wall at the given position to the given value, counting down every gem it stops covering. </summary>
+/// <param name="_position"> The position of the cell. </param>
+/// <param name="_value"> The new value, which is no higher than the current value. </param>
+void Minigames::MiningMinigame::setWallValue(const Point _position, const uint8_t _value)
+{
+	uint8_t oldValue = m_wallData.GetValueAt(_position);
+	m_wallData.SetValueAt(_position.x, _position.y, _value);
 
-			// Only check against other gems if the gem is otherwise valid.
-			if (isValid)
-			{
-				for (uint32_t i = 0; i < m_wallGems.size(); i++)
-				{
-					// If the gems collide, set it to invalid and break the check loop.
-					if (m_wallGems[i].CollidesWith(gem)) { isValid = false; break; }
-				}
-			}
+	// Go over the gems this cell covers, any whose layer has been passed have one less covered cell, and are uncovered once none are left.
+	uint32_t cellIndex = _position.y * m_wallData.GetWidth() + _position.x;
+	for (uint32_t i = m_cellGemOffsets[cellIndex]; i < m_cellGemOffsets[cellIndex + 1]; i++)
+	{
+		uint16_t gemIndex = m_cellGems[i];
+		uint8_t layer = m_wallGems[gemIndex].GetLayer();
+		if (oldValue >= layer && _value < layer && --m_coveredCellCounts[gemIndex] == 0) { m_uncoveredGems.push_back(gemIndex); }
+	}
+}
 
+/// <summary> Finds the top gem of each cell of the wall, so that a cell can be hit tested without going over every gem. </summary>
+void Minigames::MiningMinigame::buildGemCells()
+{
+	// Start with no gem over any cell.
+	m_gemCells.assign(m_wallData.GetWidth() * m_wallData.GetHeight(), GemCell{ 0, 0 });
 
-		} while (!isValid);
+	// Go over the area of each gem, keeping the gem on the highest layer for each cell it covers.
+	for (uint16_t g = 0; g < m_wallGems.size(); g++)
+	{
+		// Mined gems cannot be hit.
+		if (m_coveredCellCounts[g] == 0) { continue; }
 
-		// Add the gem to the vector and reduce the remaining prosperity.
-		remainingProsperity = std::max(0, (int32_t)remainingProsperity - gem.GetValue());
-		m_wallGems.push_back(gem);
+		const WallGem& gem = m_wallGems[g];
+		for (int32_t x = 0; x < gem.GetWidth(); x++)
+		{
+			for (int32_t y = 0; y < gem.GetHeight(); y++)
+			{
+				Point wallPosition = gem.GetWallPosition() + Point(x, y);
+				if (!m_wallData.IsInRange(wallPosition) || !gem.CollidesWith(wallPosition)) { continue; }
+
+				GemCell& gemCell = m_gemCells[wallPosition.y * m_wallData.GetWidth() + wallPosition.x];
+				if (gem.GetLayer() > gemCell.m_layer) { gemCell = GemCell{ g, gem.GetLayer() }; }
+			}
+		}
 	}
 }
 
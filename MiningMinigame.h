@@ -7,6 +7,7 @@
 #include "Point.h"
 #include "WallData.h"
 #include "WallGem.h"
+#include "WallGemPlacer.h"
 
 // Service includes.
 #include "ServiceProvider.h"
@@ -29,7 +30,7 @@ namespace Minigames
 	{
 	public:
 		/// <summary> Creates the initial minigame. </summary>
-		MiningMinigame() : m_collapseTimer(c_maxTimer), m_wallData(120, 60), m_wallGems() { }
+		MiningMinigame() : m_collapseTimer(c_maxTimer), m_wallData(120, 60), m_wallGems(), m_gemPlacer(), m_coveredCellCounts(), m_uncoveredGems(), m_gemCells(), m_cellGemOffsets(), m_cellGems(), m_damagedCells() { }
 
 		void Initialise(Events::Events&);
 
@@ -37,6 +38,16 @@ namespace Minigames
 
 		void Prepare(Services::ServiceProvider&, Point, uint8_t);
 	private:
+		/// <summary> Represents the gem on the highest layer that covers a cell of the wall, which is the first to be hit as the cell is mined down. </summary>
+		struct GemCell
+		{
+			/// <summary> The index of the gem in <see cref="m_wallGems"/>. </summary>
+			uint16_t	m_gemIndex;
+
+			/// <summary> The layer of the gem, or <c>0</c> if no gem covers the cell. </summary>
+			uint8_t		m_layer;
+		};
+
 		/// <summary> The tools. </summary>
 		static Tool					s_tools[3];
 
@@ -46,9 +57,30 @@ namespace Minigames
 		/// <summary> The tile data. </summary>
 		WallData					m_wallData;
 
-		/// <summary> The gems within the wall. </summary>
+		/// <summary> The gems within the wall, sorted by layer. Gems are never removed, instead a mined gem has no covered cells. </summary>
 		std::vector<WallGem>		m_wallGems;
 
+		/// <summary> Places the gems into the wall, keeping its memory between walls. </summary>
+		WallGemPlacer				m_gemPlacer;
+
+		/// <summary> How many cells still cover each gem, the gem is uncovered once this reaches <c>0</c>. </summary>
+		std::vector<uint8_t>		m_coveredCellCounts;
+
+		/// <summary> The index of each gem that has been uncovered since the last mined event, which is yet to be awarded. </summary>
+		std::vector<uint16_t>		m_uncoveredGems;
+
+		/// <summary> The gem on the highest layer over each cell of the wall, going along each row. </summary>
+		std::vector<GemCell>		m_gemCells;
+
+		/// <summary> Where the gems covered by each cell start in <see cref="m_cellGems"/>, with one more offset at the end for the end of the last cell. </summary>
+		std::vector<uint32_t>		m_cellGemOffsets;
+
+		/// <summary> The index of every gem covered by each cell, grouped by cell. </summary>
+		std::vector<uint16_t>		m_cellGems;
+
+		/// <summary> The position in pixels of each tile damaged by the current click, which each make particles. </summary>
+		std::vector<Point>			m_damagedCells;
+
 		/// <summary> The position of the tile on the map. </summary>
 		Point						m_tilePosition;
 
@@ -61,7 +93,13 @@ namespace Minigames
 		/// <summary> The menu for the minigame. </summary>
 		UserInterface::MinigameMenu m_minigameMenu;
 
-		void placeGems(uint8_t);
+		void placeGems(uint8_t, Random::RandomStream&);
+
+		void buildGemCells();
+
+		void buildGemCoverage();
+
+		void setWallValue(Point, uint8_t);
 
 		void changeTool(Events::EventContext*);
 
@@ -0,0 +1,28 @@
+#ifndef NULLAUDIO_H
+#define NULLAUDIO_H
+
+// Derived includes.
+#include "Audio.h"
+
+namespace Audio
+{
+	/// <summary> Represents audio that plays nothing, for running the game without a sound device. </summary>
+	class NullAudio : public Audio
+	{
+	public:
+		virtual void PlaySound(uint16_t) {}
+
+		virtual void PlayRandomSound(uint16_t) {}
+
+		virtual void PlaySong(uint16_t) {}
+
+		virtual void PlayRandomSong() {}
+
+		virtual void StopSong() {}
+
+		/// <summary> Claims that a song is always playing, so that nothing tries to start one. </summary>
+		/// <returns> <c>true</c>. </returns>
+		virtual bool IsSongPlaying() { return true; }
+	};
+}
+#endif
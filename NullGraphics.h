@@ -0,0 +1,60 @@
+#ifndef NULLGRAPHICS_H
+#define NULLGRAPHICS_H
+
+// Derived includes.
+#include "Graphics.h"
+
+namespace Graphics
+{
+	/// <summary> Represents graphics that draw nothing, for running the game without a display. </summary>
+	class NullGraphics : public Graphics
+	{
+	public:
+		virtual void Clear(Colour) {}
+
+		virtual void Present() {}
+
+		virtual void Draw(uint16_t, uint16_t, Point) {}
+
+		virtual void Draw(uint16_t, uint16_t, float_t, Point) {}
+
+		virtual void Draw(uint16_t, uint16_t, Point, float_t, float_t) {}
+
+		virtual void Draw(uint16_t, uint16_t, Point, float_t) {}
+
+		virtual void Draw(uint16_t, uint16_t, Rectangle) {}
+
+		virtual void Draw(uint16_t, uint16_t, Rectangle, float_t) {}
+
+		virtual void Draw(uint16_t, uint16_t, Rectangle, Rectangle) {}
+
+		virtual void Draw(uint16_t, uint16_t, Rectangle, Rectangle, float_t) {}
+
+		virtual void BeginBatch() {}
+
+		virtual void EndBatch() {}
+
+		virtual void DrawString(uint16_t, std::string, Point, Colour) {}
+
+		virtual void DrawString(uint16_t, std::string, Rectangle, Colour) {}
+
+		virtual void CreateCanvas(uint16_t, Point) {}
+
+		virtual void CreateTargetCanvas(uint16_t, Point) {}
+
+		virtual void BeginCanvasDraw(uint16_t) {}
+
+		virtual void EndCanvasDraw() {}
+
+		virtual void SetCanvasPixels(uint16_t, Rectangle, const Colour*) {}
+
+		virtual void DrawCanvas(uint16_t, Rectangle) {}
+
+		virtual void DrawCanvas(uint16_t, Rectangle, Rectangle) {}
+
+		/// <summary> Gets a fully transparent colour, as no sprites are loaded. </summary>
+		/// <returns> A fully transparent colour. </returns>
+		virtual Colour GetSpriteColour(uint16_t, uint16_t) { return { 0, 0, 0, 0 }; }
+	};
+}
+#endif
@@ -0,0 +1,34 @@
+#ifndef NULLSCREEN_H
+#define NULLSCREEN_H
+
+// Derived includes.
+#include "Screen.h"
+
+namespace Screens
+{
+	/// <summary> Represents a screen that is exactly the same as the window, so that screen and window positions never need converting. </summary>
+	class NullScreen : public Screen
+	{
+	public:
+		virtual Point		ScreenToWindowSpace(const Point _screenPosition)		{ return _screenPosition; }
+
+		virtual Point		WindowToScreenSpace(const Point _windowPosition)		{ return _windowPosition; }
+
+		virtual Point		ScreenToWindowSize(const Point _screenSize)				{ return _screenSize; }
+
+		virtual int32_t		ScreenToWindowSize(const int32_t _screenSize)			{ return _screenSize; }
+
+		virtual Point		WindowToScreenSize(const Point _windowSize)				{ return _windowSize; }
+
+		virtual int32_t		WindowToScreenSize(const int32_t _windowSize)			{ return _windowSize; }
+
+		virtual Rectangle	ScreenToWindowBounds(const Rectangle _screenBounds)		{ return _screenBounds; }
+
+		virtual Rectangle	WindowToScreenBounds(const Rectangle _windowBounds)		{ return _windowBounds; }
+
+		virtual float_t		GetScale()												{ return 1.0f; }
+
+		virtual void		ShakeScreen(uint16_t)									{}
+	};
+}
+#endif
@@ -6,6 +6,7 @@
 
 // Utility includes.
 #include "Random.h"
+#include <vector>
 
 // Typedef includes.
 #include <stdint.h>
@@ -24,6 +25,13 @@ namespace Particles
 		/// <param name="_startSpriteIndex"> The minimum value for the sprite index. </param>
 		/// <param name="_endSpriteIndex"> The maximum value for the sprite index. </param>
 		virtual void AddParticles(Point _position, uint16_t _amount, uint16_t _startSpriteIndex, uint16_t _endSpriteIndex) = 0;
+
+		/// <summary> Creates the given amount of particles at each of the given positions all at once, using the given start and end indices for sprite selection. </summary>
+		/// <param name="_positions"> The positions at which the particles will start. </param>
+		/// <param name="_amount"> The amount of particles to add at each position. </param>
+		/// <param name="_startSpriteIndex"> The minimum value for the sprite index. </param>
+		/// <param name="_endSpriteIndex"> The maximum value for the sprite index. </param>
+		virtual void AddParticles(const std::vector<Point>& _positions, uint16_t _amount, uint16_t _startSpriteIndex, uint16_t _endSpriteIndex) = 0;
 	};
 }
 #endif
\ No newline at end of file
@@ -14,7 +14,7 @@ std::vector<Point> Point::getCoveredPoints(const Vector2 _start, const Vector2 _
 	float_t yDist = abs((_start - _end).y);
 
 	// How many grid tiles to check based on the distance.
-	uint16_t steps = 1 + xDist + yDist;
+	uint32_t steps = 1 + xDist + yDist;
 
 	// If the end position is to the right of the start, increment right, otherwise go left.
 	int8_t xInc = (_end.x > _start.x) ? 1 : -1;
@@ -6,6 +6,7 @@
 
 // Utility includes.
 #include <vector>
+#include <cstdlib>
 
 // Typedef includes.
 #include <stdint.h>
@@ -45,6 +46,47 @@ struct Point
 
 	static std::vector<Point> getCoveredPoints(Vector2, Vector2);
 
+	/// <summary> Visits every <see cref="Point"/> covered by a line going from the centre of the start cell to the centre of the end cell, using only whole numbers and without allocating. </summary>
+	/// <param name="_start"> The start cell. </param>
+	/// <param name="_end"> The end cell. </param>
+	/// <param name="_visitor"> Called with each covered point in order from the start, returns <c>false</c> to stop the line early. </param>
+	/// <returns> <c>true</c> if the whole line was visited; otherwise, <c>false</c> if the visitor stopped it. </returns>
+	/// <remarks> Covers exactly the same points as <see cref="getCoveredPoints"/> given the centres of cells with positive positions. </remarks>
+	template <class Visitor> static bool visitCoveredPoints(const Point _start, const Point _end, Visitor _visitor)
+	{
+		// The distance between the start and end positions.
+		int32_t xDist = std::abs(_end.x - _start.x);
+		int32_t yDist = std::abs(_end.y - _start.y);
+
+		// If the end position is to the right of the start, increment right, otherwise go left.
+		int32_t xInc = (_end.x > _start.x) ? 1 : -1;
+		int32_t yInc = (_end.y > _start.y) ? 1 : -1;
+
+		// Error is positive when the closest tile is on the x axis and negative on the y axis.
+		int32_t error = xDist - yDist;
+
+		// Visit every point between the start and end positions, stopping if the visitor says so.
+		Point current = _start;
+		for (int32_t steps = 1 + xDist + yDist; steps > 0; --steps)
+		{
+			if (!_visitor(current)) { return false; }
+
+			// If error is positive, go right and decrease error by the y distance. This eventually causes error to be negative.
+			if (error > 0)
+			{
+				current.x += xInc;
+				error -= yDist;
+			}
+			else
+			{
+				current.y += yInc;
+				error += xDist;
+			}
+		}
+
+		return true;
+	}
+
 	bool operator==(const Point& _other)	const	{ return (x == _other.x && y == _other.y); }
 	bool operator!=(const Point& _other)	const	{ return (x != _other.x || y != _other.y); }
 
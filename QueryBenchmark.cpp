@@ -0,0 +1,80 @@
+#include "QueryBenchmark.h"
+
+// Generation includes.
+#include "DungeonGenerator.h"
+
+// Game object includes.
+#include "MapObject.h"
+
+// Utility includes.
+#include "Random.h"
+#include <iomanip>
+
+/// <summary> Generates a seeded dungeon of the given size, then times each query over every cell through the adapter and through the view. </summary>
+/// <param name="_size"> The width and height of the map. </param>
+/// <returns> The measurements of both ways of reading the map. </returns>
+Benchmarks::QuerySample Benchmarks::QueryBenchmark::Run(const uint32_t _size) const
+{
+	QuerySample sample = QuerySample();
+	sample.m_size = _size;
+	sample.m_calls = (uint64_t)m_passes * _size * _size;
+
+	// Generate the dungeon to query.
+	WorldObjects::TileMap map(_size, _size);
+	MapGeneration::DungeonGenerator generator;
+	GameObjects::MapObject spawn, exit;
+	Random::RandomStream random(m_seed);
+	generator.Generate(map, random, spawn, exit);
+
+	// Read the adapter back through a volatile pointer, so that the compiler cannot see that it is a TileMap and turn the virtual calls into direct ones.
+	WorldObjects::IReadOnlyTileMap* volatile hiddenAdapter = &map;
+	WorldObjects::IReadOnlyTileMap& adapter = *hiddenAdapter;
+	WorldObjects::TileMap::View view = map.GetView();
+
+	// Time each query both ways, then check that both ways gave the same total.
+	uint64_t adapterTotal = 0, viewTotal = 0;
+	sample.m_adapterMazeNodeNS = measure((int32_t)_size, [&adapter](const Point _position) { return (uint64_t)isCellValidMazeNode(adapter, _position); }, adapterTotal);
+	sample.m_viewMazeNodeNS = measure((int32_t)_size, [&view](const Point _position) { return (uint64_t)isCellValidMazeNode(view, _position); }, viewTotal);
+	if (adapterTotal != viewTotal) { sample.m_mismatches++; }
+
+	sample.m_adapterAdjacentNS = measure((int32_t)_size, [&adapter](const Point _position) { return (uint64_t)getAdjacentFloorCellsAmount(adapter, _position); }, adapterTotal);
+	sample.m_viewAdjacentNS = measure((int32_t)_size, [&view](const Point _position) { return (uint64_t)getAdjacentFloorCellsAmount(view, _position); }, viewTotal);
+	if (adapterTotal != viewTotal) { sample.m_mismatches++; }
+
+	return sample;
+}
+
+/// <summary> Writes the names of each column of the summaries. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::QueryBenchmark::WriteHeader(std::ostream& _output, const bool _isCSV)
+{
+	const char* columns[] = { "size", "calls", "adapter_node_ns", "view_node_ns", "adapter_adj_ns", "view_adj_ns", "mismatches" };
+	for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++)
+	{
+		if (_isCSV) { _output << (i > 0 ? "," : "") << columns[i]; }
+		else { _output << std::setw(16) << columns[i]; }
+	}
+	_output << std::endl;
+}
+
+/// <summary> Writes the given sample on one line. </summary>
+/// <param name="_output"> The stream to write to. </param>
+/// <param name="_sample"> The sample to write. </param>
+/// <param name="_isCSV"> <c>true</c> to separate the columns by commas; otherwise, they are lined up with spaces. </param>
+void Benchmarks::QueryBenchmark::WriteSummary(std::ostream& _output, const QuerySample& _sample, const bool _isCSV)
+{
+	double_t values[] = { _sample.m_adapterMazeNodeNS, _sample.m_viewMazeNodeNS, _sample.m_adapterAdjacentNS, _sample.m_viewAdjacentNS };
+
+	if (_isCSV) { _output << _sample.m_size << ',' << _sample.m_calls; }
+	else { _output << std::setw(16) << _sample.m_size << std::setw(16) << _sample.m_calls; }
+	_output << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+	{
+		if (_isCSV) { _output << ',' << values[i]; }
+		else { _output << std::setw(16) << values[i]; }
+	}
+	if (_isCSV) { _output << ',' << _sample.m_mismatches; }
+	else { _output << std::setw(16) << _sample.m_mismatches; }
+	_output << std::defaultfloat << std::endl;
+}
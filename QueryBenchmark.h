@@ -0,0 +1,111 @@
+#ifndef QUERYBENCHMARK_H
+#define QUERYBENCHMARK_H
+
+// Data includes.
+#include "TileMap.h"
+#include "Point.h"
+
+// Utility includes.
+#include "Direction.h"
+#include <chrono>
+#include <ostream>
+
+// Typedef includes.
+#include <cmath>
+#include <stdint.h>
+
+namespace Benchmarks
+{
+	/// <summary> Represents the cost of the cell queries of the dungeon generator on one map, made both through the <see cref="WorldObjects::IReadOnlyTileMap"/> adapter and through the <see cref="WorldObjects::TileMap::View"/>. </summary>
+	struct QuerySample
+	{
+		/// <summary> The width and height of the map. </summary>
+		uint32_t	m_size;
+
+		/// <summary> The amount of calls made to each query. </summary>
+		uint64_t	m_calls;
+
+		/// <summary> The mean time of a maze node check through the adapter in nanoseconds. </summary>
+		double_t	m_adapterMazeNodeNS;
+
+		/// <summary> The mean time of a maze node check through the view in nanoseconds. </summary>
+		double_t	m_viewMazeNodeNS;
+
+		/// <summary> The mean time of an adjacent floor count through the adapter in nanoseconds. </summary>
+		double_t	m_adapterAdjacentNS;
+
+		/// <summary> The mean time of an adjacent floor count through the view in nanoseconds. </summary>
+		double_t	m_viewAdjacentNS;
+
+		/// <summary> The amount of queries where the adapter and the view did not give the same total. </summary>
+		uint32_t	m_mismatches;
+	};
+
+	/// <summary> Represents a benchmark that generates a dungeon, then asks every cell whether it is a valid maze node and how many floors are next to it, the same as the dungeon generator does, once through each way of reading the map. </summary>
+	class QueryBenchmark
+	{
+	public:
+		/// <summary> Creates a new benchmark that queries every cell of each map the given amount of times. </summary>
+		/// <param name="_passes"> The amount of times every cell is queried. </param>
+		/// <param name="_seed"> The seed of the generated dungeons. </param>
+		QueryBenchmark(const uint32_t _passes, const uint32_t _seed) : m_passes(_passes), m_seed(_seed) {}
+
+		QuerySample Run(uint32_t) const;
+
+		static void WriteHeader(std::ostream&, bool);
+
+		static void WriteSummary(std::ostream&, const QuerySample&, bool);
+	private:
+		/// <summary> The amount of times every cell is queried. </summary>
+		uint32_t	m_passes;
+
+		/// <summary> The seed of the generated dungeons. </summary>
+		uint32_t	m_seed;
+
+		/// <summary> Finds if the given cell is a valid maze node, the same as <see cref="MapGeneration::DungeonGenerator"/> does, with either way of reading the map. </summary>
+		/// <param name="_map"> The adapter or the view to query. </param>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the cell is in range and no adjacent cell is clear; otherwise, <c>false</c>. </returns>
+		template <class Map> static inline bool isCellValidMazeNode(Map& _map, const Point _position)
+		{
+			if (!_map.IsCellInRange(_position)) { return false; }
+
+			return	!(_map.IsCellClearAndInRange(_position + Direction(Directions::Left).GetNormal()) || _map.IsCellClearAndInRange(_position + Direction(Directions::Right).GetNormal())
+					|| _map.IsCellClearAndInRange(_position + Direction(Directions::Down).GetNormal()) || _map.IsCellClearAndInRange(_position + Direction(Directions::Up).GetNormal()));
+		}
+
+		/// <summary> Gets the amount of floors adjacent to the given cell, the same as <see cref="MapGeneration::DungeonGenerator"/> does, with either way of reading the map. </summary>
+		/// <param name="_map"> The adapter or the view to query. </param>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> The amount of adjacent floors. </returns>
+		template <class Map> static inline int32_t getAdjacentFloorCellsAmount(Map& _map, const Point _position)
+		{
+			uint8_t emptySideAmount = 0;
+			if (_map.IsCellClearAndInRange(_position + Direction(Directions::Left).GetNormal()))	{ emptySideAmount++; }
+			if (_map.IsCellClearAndInRange(_position + Direction(Directions::Up).GetNormal()))		{ emptySideAmount++; }
+			if (_map.IsCellClearAndInRange(_position + Direction(Directions::Right).GetNormal()))	{ emptySideAmount++; }
+			if (_map.IsCellClearAndInRange(_position + Direction(Directions::Down).GetNormal()))	{ emptySideAmount++; }
+			return emptySideAmount;
+		}
+
+		/// <summary> Calls the given query on every cell of a map of the given size the set amount of times. </summary>
+		/// <param name="_size"> The width and height of the map. </param>
+		/// <param name="_query"> The query, which takes a position and returns a number that is added to the total. </param>
+		/// <param name="_total"> Set to the sum of every result, so that the calls cannot be skipped and so that the results can be compared. </param>
+		/// <returns> The mean time of a call in nanoseconds. </returns>
+		template <class Query> double_t measure(const int32_t _size, Query _query, uint64_t& _total) const
+		{
+			_total = 0;
+			std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < m_passes; i++)
+			{
+				for (int32_t y = 0; y < _size; y++)
+				{
+					for (int32_t x = 0; x < _size; x++) { _total += _query(Point(x, y)); }
+				}
+			}
+			return std::chrono::duration<double_t, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / std::max(1.0, (double_t)m_passes * _size * _size);
+		}
+	};
+}
+#endif
@@ -2,29 +2,115 @@
 #define RANDOM_H
 
 // Utility includes.
-#include <random>
-#include <chrono>
+#include <utility>
+#include <vector>
 
 // Typedef includes.
 #include <cmath>
+#include <stdint.h>
+#include <stddef.h>
 
-/// <summary> Reprents wrapped functions for easy randomness. </summary>
 namespace Random
 {
-	/// <summary> The seed used for the randomness. </summary>
-	static long seed = std::chrono::system_clock::now().time_since_epoch().count();
-	
-	/// <summary> The random number generator itself. </summary>
-	static std::default_random_engine generator(seed);
-	
-	/// <summary> Gets a random value between the given min and max, inclusive. </summary>
-	/// <param name="_min"> The minimum value. </param>
-	/// <param name="_max"> The maximum value. </param>
-	/// <returns> A random value between the given min and max. </returns>
-	inline int32_t RandomBetween(const int32_t _min, const int32_t _max) { std::uniform_int_distribution<int32_t> distribution(_min, _max); return distribution(generator); }
-
-	/// <summary> Gets a random float between <c>0</c> and <c>1</c>. </summary>
-	/// <returns> A random float between <c>0</c> and <c>1</c>. </returns>
-	inline float_t RandomScalar() { std::uniform_int_distribution<int32_t> distribution(0, 100000); return (float)distribution(generator) / 100000.0f; }
+	/// <summary> Represents a single stream of random numbers, using the xoshiro128** generator so that each value is only a few shifts and multiplies. </summary>
+	/// <remarks> A stream is not thread safe, so each subsystem or thread should draw from its own stream. </remarks>
+	class RandomStream
+	{
+	public:
+		/// <summary> Creates a stream with a seed of <c>0</c>. </summary>
+		RandomStream() : m_state(), m_callCount(0) { Seed(0); }
+
+		/// <summary> Creates a stream with the given seed. </summary>
+		/// <param name="_seed"> The seed. </param>
+		RandomStream(const uint64_t _seed) : m_state(), m_callCount(0) { Seed(_seed); }
+
+		/// <summary> Seeds this stream so that it makes the same values every time, using splitmix64 to spread the seed over the whole state. </summary>
+		/// <param name="_seed"> The seed. </param>
+		inline void Seed(uint64_t _seed)
+		{
+			for (uint8_t i = 0; i < 4; i += 2)
+			{
+				uint64_t mixed = (_seed += 0x9E3779B97F4A7C15ull);
+				mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+				mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+				mixed ^= mixed >> 31;
+				m_state[i] = (uint32_t)mixed;
+				m_state[i + 1] = (uint32_t)(mixed >> 32);
+			}
+		}
+
+		/// <summary> Gets the next raw 32 bit value of the stream. </summary>
+		/// <returns> A random value across the whole range of a <c>uint32_t</c>. </returns>
+		inline uint32_t Next()
+		{
+			m_callCount++;
+			const uint32_t result = rotateLeft(m_state[1] * 5, 7) * 9;
+			const uint32_t shifted = m_state[1] << 9;
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= shifted;
+			m_state[3] = rotateLeft(m_state[3], 11);
+			return result;
+		}
+
+		/// <summary> Gets a random value between the given min and max, inclusive. </summary>
+		/// <param name="_min"> The minimum value. </param>
+		/// <param name="_max"> The maximum value. </param>
+		/// <returns> A random value between the given min and max. </returns>
+		inline int32_t Between(const int32_t _min, const int32_t _max)
+		{
+			// Scale a raw value into the range with a multiply rather than a divide, rerolling the rare values that would make some results more likely.
+			const uint32_t range = (uint32_t)_max - (uint32_t)_min + 1;
+			if (range == 0) { return (int32_t)Next(); }
+			uint64_t scaled = (uint64_t)Next() * range;
+			if ((uint32_t)scaled < range)
+			{
+				const uint32_t threshold = (0u - range) % range;
+				while ((uint32_t)scaled < threshold) { scaled = (uint64_t)Next() * range; }
+			}
+			return (int32_t)((uint32_t)_min + (uint32_t)(scaled >> 32));
+		}
+
+		/// <summary> Gets a random float between <c>0</c> inclusive and <c>1</c> exclusive. </summary>
+		/// <returns> A random float between <c>0</c> and <c>1</c>. </returns>
+		inline float_t Scalar() { return (Next() >> 8) * (1.0f / 16777216.0f); }
+
+		/// <summary> Fills the given values with random values between the given min and max, inclusive. </summary>
+		/// <param name="_values"> The values to fill. </param>
+		/// <param name="_count"> The amount of values to fill. </param>
+		/// <param name="_min"> The minimum value. </param>
+		/// <param name="_max"> The maximum value. </param>
+		inline void FillBetween(int32_t* _values, const size_t _count, const int32_t _min, const int32_t _max) { for (size_t i = 0; i < _count; i++) { _values[i] = Between(_min, _max); } }
+
+		/// <summary> Fills the given values with random floats between <c>0</c> inclusive and <c>1</c> exclusive. </summary>
+		/// <param name="_values"> The values to fill. </param>
+		/// <param name="_count"> The amount of values to fill. </param>
+		inline void FillScalar(float_t* _values, const size_t _count) { for (size_t i = 0; i < _count; i++) { _values[i] = Scalar(); } }
+
+		/// <summary> Shuffles the given values into a random order, the same way on every platform. </summary>
+		/// <param name="_values"> The values to shuffle. </param>
+		template <class T> inline void Shuffle(std::vector<T>& _values)
+		{
+			for (size_t i = _values.size(); i > 1; i--) { std::swap(_values[i - 1], _values[Between(0, (int32_t)i - 1)]); }
+		}
+
+		/// <summary> Gets the amount of raw values this stream has made. </summary>
+		/// <returns> The amount of raw values made. </returns>
+		inline uint64_t GetCallCount() const { return m_callCount; }
+	private:
+		/// <summary> The state of the generator. </summary>
+		uint32_t m_state[4];
+
+		/// <summary> The amount of raw values that have been made. </summary>
+		uint64_t m_callCount;
+
+		/// <summary> Rotates the bits of the given value left by the given amount. </summary>
+		/// <param name="_value"> The value to rotate. </param>
+		/// <param name="_amount"> The amount of bits to rotate by. </param>
+		/// <returns> The rotated value. </returns>
+		static inline uint32_t rotateLeft(const uint32_t _value, const int32_t _amount) { return (_value << _amount) | (_value >> (32 - _amount)); }
+	};
 }
-#endif
\ No newline at end of file
+#endif
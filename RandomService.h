@@ -0,0 +1,52 @@
+#ifndef RANDOMSERVICE_H
+#define RANDOMSERVICE_H
+
+// Utility includes.
+#include "Random.h"
+#include <chrono>
+
+namespace Random
+{
+	/// <summary> Represents each subsystem that draws from its own stream, so that one subsystem using more or fewer values does not change what another gets. </summary>
+	enum StreamType { Generation = 0, Gameplay, Particles, Audio, Interface, Input };
+
+	/// <summary> Represents a service holding a separate stream of random numbers for each subsystem, all made from one seed. </summary>
+	class RandomService
+	{
+	public:
+		/// <summary> The amount of streams, one for each <see cref="StreamType"/>. </summary>
+		static const uint8_t c_streamAmount = StreamType::Input + 1;
+
+		/// <summary> Creates a service seeded from the clock. </summary>
+		RandomService() : RandomService((uint64_t)std::chrono::system_clock::now().time_since_epoch().count()) {}
+
+		/// <summary> Creates a service with the given seed. </summary>
+		/// <param name="_seed"> The seed. </param>
+		RandomService(const uint64_t _seed) : m_seed(0), m_streams() { Seed(_seed); }
+
+		/// <summary> Seeds every stream from the given seed, so that the same values are made every time. </summary>
+		/// <param name="_seed"> The seed. </param>
+		inline void Seed(const uint64_t _seed)
+		{
+			// Mix the type of each stream into the seed so that no two streams make the same values.
+			m_seed = _seed;
+			for (uint8_t i = 0; i < c_streamAmount; i++) { m_streams[i].Seed(_seed ^ (0xD1B54A32D192ED03ull * (i + 1))); }
+		}
+
+		/// <summary> Gets the seed that was last used. </summary>
+		/// <returns> The seed. </returns>
+		inline uint64_t GetSeed() const { return m_seed; }
+
+		/// <summary> Gets the stream of the given subsystem. </summary>
+		/// <param name="_streamType"> The subsystem. </param>
+		/// <returns> The stream. </returns>
+		inline RandomStream& GetStream(const StreamType _streamType) { return m_streams[_streamType]; }
+	private:
+		/// <summary> The seed that was last used. </summary>
+		uint64_t		m_seed;
+
+		/// <summary> The stream of each subsystem, indexed by <see cref="StreamType"/>. </summary>
+		RandomStream	m_streams[c_streamAmount];
+	};
+}
+#endif
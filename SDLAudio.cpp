@@ -2,8 +2,12 @@
 
 /// <summary> Initialises the SDL audio systems. </summary>
 /// <param name="_logger"> The logger to use for output. </param>
-void Audio::SDLAudio::Initialise(Logging::Logger& _logger)
+/// <param name="_random"> The random stream used to pick songs and sound variants. </param>
+void Audio::SDLAudio::Initialise(Logging::Logger& _logger, Random::RandomStream& _random)
 {
+	m_random = &_random;
+
+
 	// Try to initialise the mixer.
 	if (Mix_OpenAudio(22050, MIX_DEFAULT_FORMAT, 2, 4096) < 0) { _logger.Log("SDL_mixer initialisation failed."); }
 	else { _logger.Log("SDL_mixer initialisation succeeded!"); }
@@ -56,7 +60,7 @@ void Audio::SDLAudio::PlaySound(const uint16_t _soundID)
 void Audio::SDLAudio::PlayRandomSound(const uint16_t _variedSoundID)
 {
 	// Gets a random sound from the given ID.
-	Mix_Chunk* sound = m_soundVariantsByID[_variedSoundID][Random::RandomBetween(0, m_soundVariantsByID[_variedSoundID].size() - 1)];
+	Mix_Chunk* sound = m_soundVariantsByID[_variedSoundID][m_random->Between(0, m_soundVariantsByID[_variedSoundID].size() - 1)];
 
 	// Play the sound.
 	Mix_PlayChannel(-1, sound, 0);
@@ -22,9 +22,9 @@ namespace Audio
 	class SDLAudio : public Audio
 	{
 	public:
-		SDLAudio() : m_soundsByID(std::map<uint16_t, Mix_Chunk*>()), m_songsByID(std::map<uint16_t, Mix_Music*>()), m_soundVariantsByID(std::map<uint16_t, std::vector<Mix_Chunk*>>()) { }
+		SDLAudio() : m_random(NULL), m_soundsByID(std::map<uint16_t, Mix_Chunk*>()), m_songsByID(std::map<uint16_t, Mix_Music*>()), m_soundVariantsByID(std::map<uint16_t, std::vector<Mix_Chunk*>>()) { }
 
-		void Initialise(Logging::Logger&);
+		void Initialise(Logging::Logger&, Random::RandomStream&);
 
 		void Unload();
 
@@ -35,7 +35,7 @@ namespace Audio
 		virtual void PlaySong(uint16_t);
 
 		/// <summary> Plays a random song from the list of loaded songs. </summary>
-		virtual void PlayRandomSong() { Mix_PlayMusic(m_songsByID[Random::RandomBetween(0, m_songsByID.size() - 1)], 0); }
+		virtual void PlayRandomSong() { Mix_PlayMusic(m_songsByID[m_random->Between(0, m_songsByID.size() - 1)], 0); }
 
 		/// <summary> Stops the currently playing song from playing. </summary>
 		virtual void StopSong() { Mix_HaltMusic(); }
@@ -50,6 +50,9 @@ namespace Audio
 
 		void LoadSongToID(uint16_t, std::string);
 	private:
+		/// <summary> The random stream used to pick songs and sound variants. </summary>
+		Random::RandomStream*						m_random;
+
 		/// <summary> The sound effects by ID. </summary>
 		std::map<uint16_t, Mix_Chunk*>				m_soundsByID;
 
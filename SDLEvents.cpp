@@ -31,7 +31,8 @@ void Events::SDLEvents::PumpEvents(const MainGame::GameState _currentGameState,
 		{
 			switch (currentEvent.type)
 			{
-			case SDL_QUIT: { fireEvents(eventFunctions, eventContext->SetData(NULL, NULL)); break; }
+			case SDL_QUIT: 
+			case SDL_RENDER_TARGETS_RESET: { fireEvents(eventFunctions, eventContext->SetData(NULL, NULL)); break; }
 			case SDL_MOUSEBUTTONDOWN:
 			case SDL_MOUSEBUTTONUP: { fireEvents(eventFunctions, eventContext->SetData(&currentEvent.button.x, &currentEvent.button.y)); break; }
 			case SDL_MOUSEMOTION: { fireEvents(eventFunctions, eventContext->SetData(&currentEvent.motion.x, &currentEvent.motion.y)); break; }
@@ -0,0 +1,148 @@
+#include "SDLFont.h"
+
+// Utility includes.
+#include <exception>
+
+/// <summary> Draws every glyph of the given font once into a single atlas texture, taking ownership of the font. </summary>
+/// <param name="_renderer"> The renderer used to create the atlas. </param>
+/// <param name="_font"> The font to draw. </param>
+void Graphics::SDLFont::Load(SDL_Renderer* _renderer, TTF_Font* _font)
+{
+	m_font = _font;
+	m_height = TTF_FontHeight(_font);
+
+	// Draw each glyph in white so that it can be coloured when drawn, and find where it will go in the atlas, going along each row.
+	SDL_Surface* glyphSurfaces[c_glyphAmount];
+	Point nextPosition(0, 0);
+	for (uint8_t i = 0; i < c_glyphAmount; i++)
+	{
+		// Get how far along the glyph moves the pen.
+		int32_t advance = 0;
+		TTF_GlyphMetrics(_font, c_firstGlyph + i, NULL, NULL, NULL, NULL, &advance);
+		m_glyphs[i].m_advance = advance;
+
+		// Draw the glyph, which may be nothing for glyphs such as a space.
+		glyphSurfaces[i] = TTF_RenderGlyph_Blended(_font, c_firstGlyph + i, { 255, 255, 255, 255 });
+		int32_t width = (glyphSurfaces[i] == nullptr) ? 0 : glyphSurfaces[i]->w;
+
+		// If the glyph does not fit on this row, move to the next.
+		if (nextPosition.x + width > c_atlasWidth) { nextPosition = Point(0, nextPosition.y + m_height); }
+
+		m_glyphs[i].m_source = { nextPosition.x, nextPosition.y, width, m_height };
+		nextPosition.x += width;
+	}
+
+	// Copy every glyph into one surface, replacing the pixels rather than blending so that the alpha is kept.
+	SDL_Surface* atlasSurface = SDL_CreateRGBSurfaceWithFormat(0, c_atlasWidth, nextPosition.y + m_height, 32, SDL_PIXELFORMAT_RGBA32);
+	if (atlasSurface == nullptr) { throw std::exception(SDL_GetError()); }
+	SDL_FillRect(atlasSurface, NULL, SDL_MapRGBA(atlasSurface->format, 255, 255, 255, 0));
+	for (uint8_t i = 0; i < c_glyphAmount; i++)
+	{
+		if (glyphSurfaces[i] == nullptr) { continue; }
+
+		SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);
+		SDL_BlitSurface(glyphSurfaces[i], NULL, atlasSurface, &m_glyphs[i].m_source);
+		SDL_FreeSurface(glyphSurfaces[i]);
+	}
+
+	// Turn the surface into the atlas texture, then release the surface.
+	m_atlas = SDL_CreateTextureFromSurface(_renderer, atlasSurface);
+	SDL_FreeSurface(atlasSurface);
+	if (m_atlas == nullptr) { throw std::exception(SDL_GetError()); }
+	SDL_SetTextureBlendMode(m_atlas, SDL_BLENDMODE_BLEND);
+}
+
+/// <summary> Destroys the atlas and closes the font. </summary>
+void Graphics::SDLFont::Unload()
+{
+	SDL_DestroyTexture(m_atlas);
+	TTF_CloseFont(m_font);
+	m_atlas = NULL;
+	m_font = NULL;
+	m_runs.clear();
+}
+
+/// <summary> Draws the given string at the given position and colour. </summary>
+/// <param name="_renderer"> The renderer. </param>
+/// <param name="_text"> The text to write. </param>
+/// <param name="_position"> The position. </param>
+/// <param name="_colour"> The colour. </param>
+void Graphics::SDLFont::DrawString(SDL_Renderer* _renderer, const std::string& _text, const Point _position, const Colour _colour)
+{
+	const ShapedRun& run = getRun(_text);
+	drawRun(_renderer, run, Rectangle(_position.x, _position.y, run.m_width, m_height), _colour);
+}
+
+/// <summary> Draws the given string stretched over the given destination in the given colour. </summary>
+/// <param name="_renderer"> The renderer. </param>
+/// <param name="_text"> The text to write. </param>
+/// <param name="_destination"> The destination. <see cref="Rectangle"/>. </param>
+/// <param name="_colour"> The colour. </param>
+void Graphics::SDLFont::DrawString(SDL_Renderer* _renderer, const std::string& _text, const Rectangle _destination, const Colour _colour)
+{
+	drawRun(_renderer, getRun(_text), _destination, _colour);
+}
+
+/// <summary> Gets the quads of the given string, laying it out and remembering it if it has not been seen recently. </summary>
+/// <param name="_text"> The text. </param>
+/// <returns> The laid out string. </returns>
+const Graphics::SDLFont::ShapedRun& Graphics::SDLFont::getRun(const std::string& _text)
+{
+	// If the string has been laid out already, use that.
+	std::unordered_map<std::string, ShapedRun>::iterator cachedRun = m_runs.find(_text);
+	if (cachedRun != m_runs.end()) { return cachedRun->second; }
+
+	// If too many strings are remembered, such as from a counter that changes every frame, forget them all so that the cache stays small.
+	if (m_runs.size() >= c_maxCachedRuns) { m_runs.clear(); }
+
+	// Lay out each character along the line, moving the pen by the advance and kerning of each.
+	ShapedRun run;
+	run.m_sources.reserve(_text.size());
+	run.m_destinations.reserve(_text.size());
+	int32_t penX = 0;
+	for (size_t i = 0; i < _text.size(); i++)
+	{
+		// Apply the kerning between this character and the last.
+		if (i > 0) { penX += TTF_GetFontKerningSizeGlyphs(m_font, _text[i - 1], _text[i]); }
+
+		// Add a quad for the glyph, unless it is blank.
+		const Glyph& glyph = m_glyphs[getGlyphIndex(_text[i])];
+		if (glyph.m_source.w > 0)
+		{
+			run.m_sources.push_back(glyph.m_source);
+			run.m_destinations.push_back({ penX, 0, glyph.m_source.w, glyph.m_source.h });
+		}
+
+		penX += glyph.m_advance;
+	}
+	run.m_width = penX;
+
+	return m_runs.emplace(_text, run).first->second;
+}
+
+/// <summary> Draws the given laid out string stretched over the given destination in the given colour. </summary>
+/// <param name="_renderer"> The renderer. </param>
+/// <param name="_run"> The laid out string. </param>
+/// <param name="_destination"> The destination. <see cref="Rectangle"/>. </param>
+/// <param name="_colour"> The colour. </param>
+void Graphics::SDLFont::drawRun(SDL_Renderer* _renderer, const ShapedRun& _run, const Rectangle _destination, const Colour _colour)
+{
+	// If there is nothing to draw, do nothing.
+	if (_run.m_width <= 0 || m_height <= 0) { return; }
+
+	// Calculate how much the string is stretched to fill the destination.
+	float_t scaleX = (float_t)_destination.w / _run.m_width;
+	float_t scaleY = (float_t)_destination.h / m_height;
+
+	// Colour the atlas once for the whole string, then copy each quad from it.
+	SDL_SetTextureColorMod(m_atlas, _colour.r, _colour.g, _colour.b);
+	SDL_SetTextureAlphaMod(m_atlas, _colour.a);
+	for (size_t i = 0; i < _run.m_sources.size(); i++)
+	{
+		const SDL_Rect& quad = _run.m_destinations[i];
+		int32_t minX = _destination.x + (int32_t)(quad.x * scaleX);
+		int32_t maxX = _destination.x + (int32_t)((quad.x + quad.w) * scaleX);
+		SDL_Rect destination = { minX, _destination.y + (int32_t)(quad.y * scaleY), maxX - minX, (int32_t)ceil(quad.h * scaleY) };
+		SDL_RenderCopy(_renderer, m_atlas, &_run.m_sources[i], &destination);
+	}
+}
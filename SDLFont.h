@@ -0,0 +1,97 @@
+#ifndef SDLFONT_H
+#define SDLFONT_H
+
+// Framework includes.
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+// Data includes.
+#include "Rectangle.h"
+#include "Point.h"
+#include "Colour.h"
+
+// Utility includes.
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Graphics
+{
+	/// <summary> Represents a font whose glyphs have been drawn once into a single atlas texture, which draws strings as quads from the atlas. </summary>
+	class SDLFont
+	{
+	public:
+		/// <summary> The first character that is put into the atlas. </summary>
+		static const char c_firstGlyph = ' ';
+
+		/// <summary> The last character that is put into the atlas. </summary>
+		static const char c_lastGlyph = '~';
+
+		/// <summary> The amount of characters in the atlas. </summary>
+		static const uint8_t c_glyphAmount = c_lastGlyph - c_firstGlyph + 1;
+
+		/// <summary> The width of the atlas texture in pixels. </summary>
+		static const int32_t c_atlasWidth = 512;
+
+		/// <summary> The most laid out strings that are remembered before they are all forgotten. </summary>
+		static const uint32_t c_maxCachedRuns = 128;
+
+		SDLFont() : m_font(NULL), m_atlas(NULL), m_glyphs(), m_height(0), m_runs() {}
+
+		void Load(SDL_Renderer*, TTF_Font*);
+
+		void Unload();
+
+		void DrawString(SDL_Renderer*, const std::string&, Point, Colour);
+
+		void DrawString(SDL_Renderer*, const std::string&, Rectangle, Colour);
+	private:
+		/// <summary> Represents where a single character is in the atlas and how far it moves the pen. </summary>
+		struct Glyph
+		{
+			/// <summary> The area of the atlas holding the character. </summary>
+			SDL_Rect	m_source;
+
+			/// <summary> How far along the next character starts. </summary>
+			int32_t		m_advance;
+		};
+
+		/// <summary> Represents a string that has already been laid out into quads. </summary>
+		struct ShapedRun
+		{
+			/// <summary> The area of the atlas of each quad. </summary>
+			std::vector<SDL_Rect>	m_sources;
+
+			/// <summary> The destination of each quad, relative to the top-left of the string. </summary>
+			std::vector<SDL_Rect>	m_destinations;
+
+			/// <summary> The width of the whole string in pixels. </summary>
+			int32_t					m_width;
+		};
+
+		/// <summary> The font, which is kept for kerning while laying out strings. </summary>
+		TTF_Font*									m_font;
+
+		/// <summary> The texture holding every glyph. </summary>
+		SDL_Texture*								m_atlas;
+
+		/// <summary> The glyph of each character, starting at <see cref="c_firstGlyph"/>. </summary>
+		Glyph										m_glyphs[c_glyphAmount];
+
+		/// <summary> The height of a line of text in pixels. </summary>
+		int32_t										m_height;
+
+		/// <summary> The laid out strings keyed by their text. </summary>
+		std::unordered_map<std::string, ShapedRun>	m_runs;
+
+		const ShapedRun&	getRun(const std::string&);
+
+		void				drawRun(SDL_Renderer*, const ShapedRun&, Rectangle, Colour);
+
+		/// <summary> Gets the index of the glyph for the given character, using a question mark for characters that are not in the atlas. </summary>
+		/// <param name="_character"> The character. </param>
+		/// <returns> The index into <see cref="m_glyphs"/>. </returns>
+		static inline uint8_t getGlyphIndex(const char _character) { return (_character >= c_firstGlyph && _character <= c_lastGlyph) ? _character - c_firstGlyph : '?' - c_firstGlyph; }
+	};
+}
+#endif
@@ -4,7 +4,7 @@
 #include <SDL_image.h>
 
 /// <summary> Creates the SDL Graphics object. </summary>
-Graphics::SDLGraphics::SDLGraphics() : m_sheets(std::map<uint16_t, std::vector<SDL_Texture*>>()), m_fonts(std::map<uint16_t, TTF_Font*>())
+Graphics::SDLGraphics::SDLGraphics() : m_sheets(std::map<uint16_t, SDL_Texture*>()), m_spriteBounds(std::map<uint16_t, std::vector<Rectangle>>()), m_sheetColours(std::map<uint16_t, std::vector<Colour>>()), m_canvases(std::map<uint16_t, SDL_Texture*>()), m_fonts(std::map<uint16_t, SDLFont>()), m_batches(std::map<uint16_t, std::vector<BatchedSprite>>()), m_batchOrder(), m_isBatching(false)
 {
 	m_framesPerSecond = 60;
 }
@@ -55,22 +55,22 @@ void Graphics::SDLGraphics::Initialise(const int32_t _width, const int32_t _heig
 void Graphics::SDLGraphics::Unload()
 {
 	// Unload textures.
-	for (uint16_t i = 0; i < m_sheets.size(); i++)
+	for (std::map<uint16_t, SDL_Texture*>::iterator sheet = m_sheets.begin(); sheet != m_sheets.end(); sheet++)
 	{
-		for (uint16_t j = 0; j < m_sheets[i].size(); j++)
-		{
-			SDL_DestroyTexture(m_sheets[i][j]);
-			m_sheets[i][j] = NULL;
-		}
+		SDL_DestroyTexture(sheet->second);
+		sheet->second = NULL;
 	}
 
-	// Unload fonts.
-	for (uint16_t i = 0; i < m_fonts.size(); i++)
+	// Unload canvases.
+	for (std::map<uint16_t, SDL_Texture*>::iterator canvas = m_canvases.begin(); canvas != m_canvases.end(); canvas++)
 	{
-		TTF_CloseFont(m_fonts[i]);
-		m_fonts[i] = NULL;
+		SDL_DestroyTexture(canvas->second);
+		canvas->second = NULL;
 	}
 
+	// Unload fonts.
+	for (std::map<uint16_t, SDLFont>::iterator font = m_fonts.begin(); font != m_fonts.end(); font++) { font->second.Unload(); }
+
 	// Destroy the window.
 	SDL_DestroyRenderer(m_renderer);
 	SDL_DestroyWindow(m_window);
@@ -87,6 +87,9 @@ void Graphics::SDLGraphics::Unload()
 /// <param name="_colour"> The colour to which to clear. </param>
 void Graphics::SDLGraphics::Clear(const Colour _colour)
 {
+	// Draw anything that has been batched, so that it is cleared along with everything else.
+	submitBatch();
+
 	SDL_SetRenderDrawColor(m_renderer, _colour.r, _colour.g, _colour.b, _colour.a);
 	SDL_RenderClear(m_renderer);
 }
@@ -94,6 +97,7 @@ void Graphics::SDLGraphics::Clear(const Colour _colour)
 /// <summary> Updates the screen with everything that has been drawn. </summary>
 void Graphics::SDLGraphics::Present()
 {
+	submitBatch();
 	SDL_RenderPresent(m_renderer);
 }
 
@@ -103,14 +107,11 @@ void Graphics::SDLGraphics::Present()
 /// <param name="_position"> The position on the window. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Point _position)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
+	// Get the bounds of the texture within its sheet.
+	Rectangle bounds = m_spriteBounds[_sheetID][_textureID];
 
-	// Create the destination rectangle.
-	SDL_Rect destRect = createRectFromTexture(_position.x, _position.y, texture);
-
-	// Draw the texture at the given position.
-	SDL_RenderCopy(m_renderer, texture, NULL, &destRect);
+	// Draw the texture at the given position at its original size.
+	drawSprite(_sheetID, convertRect(bounds), createRect(_position.x, _position.y, bounds.w, bounds.h), 0);
 }
 
 /// <summary> Draws the given texture from the given sheet at the given position at the given scale. </summary>
@@ -120,16 +121,14 @@ void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textur
 /// <param name="_position"> The position on the window. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const float_t _scale, const Point _position)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
+	// Get the bounds of the texture within its sheet.
+	Rectangle bounds = m_spriteBounds[_sheetID][_textureID];
 
 	// Create and scale the destination rectangle.
-	SDL_Rect scaledDest = createRectFromTexture(_position.x, _position.y, texture);
-	scaledDest.w = ceil(scaledDest.w * _scale);
-	scaledDest.h = ceil(scaledDest.h * _scale);
+	SDL_Rect scaledDest = createRect(_position.x, _position.y, (int32_t)ceil(bounds.w * _scale), (int32_t)ceil(bounds.h * _scale));
 
 	// Draw the texture at the given position.
-	SDL_RenderCopy(m_renderer, texture, NULL, &scaledDest);
+	drawSprite(_sheetID, convertRect(bounds), scaledDest, 0);
 }
 
 /// <summary> Draws the given texture from the given sheet at the given position with the given rotation and scale. </summary>
@@ -140,16 +139,14 @@ void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textur
 /// <param name="_rotation"> The rotation in radians. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Point _position, const float_t _scale, const float_t _rotation)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
+	// Get the bounds of the texture within its sheet.
+	Rectangle bounds = m_spriteBounds[_sheetID][_textureID];
 
 	// Create and scale the destination rectangle.
-	SDL_Rect scaledDest = createRectFromTexture(_position.x, _position.y, texture);
-	scaledDest.w = ceil(scaledDest.w * _scale);
-	scaledDest.h = ceil(scaledDest.h * _scale);
+	SDL_Rect scaledDest = createRect(_position.x, _position.y, (int32_t)ceil(bounds.w * _scale), (int32_t)ceil(bounds.h * _scale));
 
 	// Draw the texture at the given position.
-	SDL_RenderCopyEx(m_renderer, texture, NULL, &scaledDest, _rotation * (180.0f / M_PI), NULL, SDL_FLIP_NONE);
+	drawSprite(_sheetID, convertRect(bounds), scaledDest, _rotation * (180.0f / M_PI));
 }
 
 /// <summary> Draws the given texture from the given sheet at the given position and rotation. </summary>
@@ -159,14 +156,11 @@ void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textur
 /// <param name="_rotation"> The rotation in radians. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Point _position, const float_t _rotation)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
+	// Get the bounds of the texture within its sheet.
+	Rectangle bounds = m_spriteBounds[_sheetID][_textureID];
 
-	// Create the destination rectangle.
-	SDL_Rect destRect = createRectFromTexture(_position.x, _position.y, texture);
-
-	// Draw the texture at the given position.
-	SDL_RenderCopyEx(m_renderer, texture, NULL, &destRect, _rotation * (180.0f / M_PI), NULL, SDL_FLIP_NONE);
+	// Draw the texture at the given position at its original size.
+	drawSprite(_sheetID, convertRect(bounds), createRect(_position.x, _position.y, bounds.w, bounds.h), _rotation * (180.0f / M_PI));
 }
 
 /// <summary> Draws the given texture from the given sheet at the given destination. </summary>
@@ -175,11 +169,7 @@ void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textur
 /// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Rectangle _destination)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
-
-	// Draw the texture at the given position.
-	SDL_RenderCopy(m_renderer, texture, NULL, &convertRect(_destination));
+	drawSprite(_sheetID, convertRect(m_spriteBounds[_sheetID][_textureID]), convertRect(_destination), 0);
 }
 
 /// <summary> Draws the given texture from the given sheet at the given destination and rotation. </summary>
@@ -189,40 +179,43 @@ void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textur
 /// <param name="_rotation"> The rotation in radians. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Rectangle _destination, const float_t _rotation)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
-
-	// Draw the texture at the given position.
-	SDL_RenderCopyEx(m_renderer, texture, NULL, &convertRect(_destination), _rotation * (180.0f / M_PI), NULL, SDL_FLIP_NONE);
+	drawSprite(_sheetID, convertRect(m_spriteBounds[_sheetID][_textureID]), convertRect(_destination), _rotation * (180.0f / M_PI));
 }
 
 /// <summary> Draws the given texture from the given sheet at the given destination from the given source. </summary>
 /// <param name="_sheetID"> The ID of the sheet from which the texture is stored. </param>
 /// <param name="_textureID"> The ID of the texture itself. </param>
 /// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
-/// <param name="_source"> The source <see cref="Rectangle"/>. </param>
+/// <param name="_source"> The source <see cref="Rectangle"/>, relative to the texture. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Rectangle _destination, const Rectangle _source)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
-
-	// Draw the texture at the given position.
-	SDL_RenderCopy(m_renderer, texture, &convertRect(_source), &convertRect(_destination));
+	drawSprite(_sheetID, getSheetSource(_sheetID, _textureID, _source), convertRect(_destination), 0);
 }
 
 /// <summary> Draws the given texture from the given sheet at the given destination and rotation from the given source. </summary>
 /// <param name="_sheetID"> The ID of the sheet from which the texture is stored. </param>
 /// <param name="_textureID"> The ID of the texture itself. </param>
 /// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
-/// <param name="_source"> The source <see cref="Rectangle"/>. </param>
+/// <param name="_source"> The source <see cref="Rectangle"/>, relative to the texture. </param>
 /// <param name="_rotation"> The rotation in radians. </param>
 void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textureID, const Rectangle _destination, const Rectangle _source, const float_t _rotation)
 {
-	// Get the texture from the IDs.
-	SDL_Texture* texture = m_sheets[_sheetID][_textureID];
+	drawSprite(_sheetID, getSheetSource(_sheetID, _textureID, _source), convertRect(_destination), _rotation * (180.0f / M_PI));
+}
 
-	// Draw the texture at the given position.
-	SDL_RenderCopyEx(m_renderer, texture, &convertRect(_source), &convertRect(_destination), _rotation * (180.0f / M_PI), NULL, SDL_FLIP_NONE);
+/// <summary> Starts collecting sprite draws instead of drawing them straight away, so that the draws of each sheet are submitted together when <see cref="EndBatch"/> is called. </summary>
+void Graphics::SDLGraphics::BeginBatch()
+{
+	// Draw anything left over from an unfinished batch first.
+	submitBatch();
+	m_isBatching = true;
+}
+
+/// <summary> Submits every sprite draw collected since <see cref="BeginBatch"/>, one sheet at a time, and goes back to drawing straight away. </summary>
+void Graphics::SDLGraphics::EndBatch()
+{
+	submitBatch();
+	m_isBatching = false;
 }
 
 /// <summary> Draws the given string with the given font at the given position and colour. </summary>
@@ -232,25 +225,11 @@ void Graphics::SDLGraphics::Draw(const uint16_t _sheetID, const uint16_t _textur
 /// <param name="_colour"> The colour. </param>
 void Graphics::SDLGraphics::DrawString(uint16_t _fontID, std::string _text, Point _position, Colour _colour)
 {
-	// Get the font.
-	TTF_Font* font = m_fonts[_fontID];
-
-	// Render the text to a surface then turn that into a texture.
-	SDL_Surface* textSurface = TTF_RenderText_Solid(font, _text.c_str(), { _colour.r, _colour.g, _colour.b });
-	SDL_Texture* textTexture = SDL_CreateTextureFromSurface(m_renderer, textSurface);
-
-	// Create the destination rect.
-	SDL_Rect destRect;
-	destRect.x = _position.x;
-	destRect.y = _position.y;
-	TTF_SizeText(font, _text.c_str(), &destRect.w, &destRect.h);
+	// Draw anything that has been batched first, so that the text goes on top.
+	submitBatch();
 
-	// Draw the text.
-	SDL_RenderCopy(m_renderer, textTexture, NULL, &destRect);
-
-	// Release the surface and texture.
-	SDL_FreeSurface(textSurface);
-	SDL_DestroyTexture(textTexture);
+	// Draw the text from the glyphs of the font.
+	m_fonts[_fontID].DrawString(m_renderer, _text, _position, _colour);
 }
 
 /// <summary> Draws the given string with the given font at the given position and colour. </summary>
@@ -260,19 +239,11 @@ void Graphics::SDLGraphics::DrawString(uint16_t _fontID, std::string _text, Poin
 /// <param name="_colour"> The colour. </param>
 void Graphics::SDLGraphics::DrawString(uint16_t _fontID, std::string _text, Rectangle _destination, Colour _colour)
 {
-	// Get the font.
-	TTF_Font* font = m_fonts[_fontID];
-
-	// Render the text to a surface then turn that into a texture.
-	SDL_Surface* textSurface = TTF_RenderText_Solid(font, _text.c_str(), { _colour.r, _colour.g, _colour.b });
-	SDL_Texture* textTexture = SDL_CreateTextureFromSurface(m_renderer, textSurface);
-
-	// Draw the text.
-	SDL_RenderCopy(m_renderer, textTexture, NULL, &convertRect(_destination));
+	// Draw anything that has been batched first, so that the text goes on top.
+	submitBatch();
 
-	// Release the surface and texture.
-	SDL_FreeSurface(textSurface);
-	SDL_DestroyTexture(textTexture);
+	// Draw the text from the glyphs of the font.
+	m_fonts[_fontID].DrawString(m_renderer, _text, _destination, _colour);
 }
 
 /// <summary> Loads the texture with the given filename to the given sheet ID. </summary>
@@ -284,49 +255,13 @@ void Graphics::SDLGraphics::LoadSheetToID(const std::string _fileName, const uin
 	// If the given ID already has a sheet loaded, throw an error.
 	if (m_sheets.count(_sheetID) > 0) { throw std::exception("Spritesheet with given ID has already been loaded."); }
 
-	// Load the texture.
-	SDL_Texture* loadedTexture = IMG_LoadTexture(m_renderer, _fileName.c_str());
+	// Load the texture, splitting it into tiles of the given size.
+	std::vector<Rectangle> textureBounds;
+	SDL_Texture* loadedTexture = loadSheetTexture(_fileName, _sheetID, _tileSize, textureBounds);
 
-	// If the loaded texture is null, throw an error.
-	if (loadedTexture == nullptr) { throw std::exception("Given texture does not exist or could not be loaded."); }
-
-	// Get the dimensions and format of the spritesheet.
-	int32_t w, h;
-	SDL_QueryTexture(loadedTexture, NULL, NULL, &w, &h);
-
-	// Calculate the width and height of the sheet in tiles.
-	int32_t widthInTiles = w / _tileSize;
-	int32_t heightInTiles = h / _tileSize;
-
-	// Create a new vector to hold the textures.
-	m_sheets.emplace(_sheetID, std::vector<SDL_Texture*>(widthInTiles * heightInTiles));
-
-	// Go over each tile in the sheet and add it to the vector.
-	for (int32_t x = 0; x < widthInTiles; x++)
-	{
-		for (int32_t y = 0; y < heightInTiles; y++)
-		{
-			// Create a new texture for this sprite.
-			SDL_Texture* spriteTexture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, _tileSize, _tileSize);
-
-			// Set the render target to the new texture.
-			SDL_SetRenderTarget(m_renderer, spriteTexture);
-			SDL_SetTextureBlendMode(spriteTexture, SDL_BLENDMODE_BLEND);
-
-			// Draw the source from the spritesheet into the sprite texture.
-			SDL_RenderCopy(m_renderer, loadedTexture, &createRect(x * _tileSize, y * _tileSize, _tileSize, _tileSize), &createRect(0, 0, _tileSize, _tileSize));
-
-			// Save the sprite to the vector.
-			m_sheets[_sheetID][x + y * widthInTiles] = spriteTexture;
-		}
-	}
-
-	// Reset the render target.
-	SDL_SetRenderTarget(m_renderer, NULL);
-
-	// Destroy the original loaded texture, also set the pointer to null to prevent a dangling pointer in case this function is to be expanded upon.
-	SDL_DestroyTexture(loadedTexture);
-	loadedTexture = NULL;
+	// Keep the whole sheet as one texture, and each tile as an area of it.
+	m_sheets.emplace(_sheetID, loadedTexture);
+	m_spriteBounds.emplace(_sheetID, textureBounds);
 }
 
 /// <summary> Loads the texture with the given filename to the given sheet ID using the given rectangles as bounds. </summary>
@@ -338,42 +273,58 @@ void Graphics::SDLGraphics::LoadSheetToID(const std::string _fileName, const uin
 	// If the given ID already has a sheet loaded, throw an error.
 	if (m_sheets.count(_sheetID) > 0) { throw std::exception("Spritesheet with given ID has already been loaded."); }
 
-	// Load the texture.
-	SDL_Texture* loadedTexture = IMG_LoadTexture(m_renderer, _fileName.c_str());
-
-	// If the loaded texture is null, throw an error.
-	if (loadedTexture == nullptr) { throw std::exception("Given texture does not exist or could not be loaded."); }
-
-	// Get the dimensions and format of the spritesheet.
-	int32_t w, h;
-	SDL_QueryTexture(loadedTexture, NULL, NULL, &w, &h);
-
-	// Create a new vector to hold the textures.
-	m_sheets.emplace(_sheetID, std::vector<SDL_Texture*>(_textureBounds.size()));
+	// Load the texture using the given bounds.
+	std::vector<Rectangle> textureBounds = _textureBounds;
+	SDL_Texture* loadedTexture = loadSheetTexture(_fileName, _sheetID, 0, textureBounds);
 
-	// Go over each given bound and add it to the vector.
-	for (uint32_t i = 0; i < _textureBounds.size(); i++)
-	{
-		// Create a new texture for this sprite.
-		SDL_Texture* spriteTexture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, _textureBounds[i].w, _textureBounds[i].h);
+	// Keep the whole sheet as one texture, and each given bound as an area of it.
+	m_sheets.emplace(_sheetID, loadedTexture);
+	m_spriteBounds.emplace(_sheetID, textureBounds);
+}
 
-		// Set the render target to the new texture.
-		SDL_SetRenderTarget(m_renderer, spriteTexture);
-		SDL_SetTextureBlendMode(spriteTexture, SDL_BLENDMODE_BLEND);
+/// <summary> Creates a blank canvas with the given ID and size, whose pixels can be written to directly, replacing any canvas that already has the ID. </summary>
+/// <param name="_canvasID"> The ID of the canvas. </param>
+/// <param name="_size"> The width and height of the canvas in pixels. </param>
+void Graphics::SDLGraphics::CreateCanvas(const uint16_t _canvasID, const Point _size)
+{
+	// Create a streaming texture whose pixels are laid out the same as a Colour.
+	createCanvas(_canvasID, _size, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING);
 
-		// Draw the source from the spritesheet into the sprite texture.
-		SDL_RenderCopy(m_renderer, loadedTexture, &createRect(_textureBounds[i].x, _textureBounds[i].y, _textureBounds[i].w, _textureBounds[i].h), &createRect(0, 0, _textureBounds[i].w, _textureBounds[i].h));
+	// Clear the canvas so that it starts out fully transparent.
+	std::vector<Colour> blankPixels(_size.x * _size.y, Colour{ 0, 0, 0, 0 });
+	SDL_UpdateTexture(m_canvases[_canvasID], NULL, blankPixels.data(), _size.x * sizeof(Colour));
+}
 
-		// Save the sprite to the vector.
-		m_sheets[_sheetID][i] = spriteTexture;
-	}
+/// <summary> Creates a blank canvas with the given ID and size that can be drawn onto like the screen, replacing any canvas that already has the ID. </summary>
+/// <param name="_canvasID"> The ID of the canvas. </param>
+/// <param name="_size"> The width and height of the canvas in pixels. </param>
+void Graphics::SDLGraphics::CreateTargetCanvas(const uint16_t _canvasID, const Point _size)
+{
+	// Create a target texture in the same format as the sprites.
+	createCanvas(_canvasID, _size, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET);
 
-	// Reset the render target.
+	// Clear the canvas so that it starts out fully transparent.
+	SDL_SetRenderTarget(m_renderer, m_canvases[_canvasID]);
+	Clear({ 0, 0, 0, 0 });
 	SDL_SetRenderTarget(m_renderer, NULL);
+}
+
+/// <summary> Writes the given pixels to the given area of the given canvas. </summary>
+/// <param name="_canvasID"> The ID of the canvas. </param>
+/// <param name="_area"> The area of the canvas to write. </param>
+/// <param name="_pixels"> The new pixels of the area in row-major order, one per pixel of the area. </param>
+void Graphics::SDLGraphics::SetCanvasPixels(const uint16_t _canvasID, const Rectangle _area, const Colour* _pixels)
+{
+	SDL_UpdateTexture(m_canvases[_canvasID], &convertRect(_area), _pixels, _area.w * sizeof(Colour));
+}
 
-	// Destroy the original loaded texture, also set the pointer to null to prevent a dangling pointer in case this function is to be expanded upon.
-	SDL_DestroyTexture(loadedTexture);
-	loadedTexture = NULL;
+/// <summary> Draws the given canvas at the given destination. </summary>
+/// <param name="_canvasID"> The ID of the canvas. </param>
+/// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
+void Graphics::SDLGraphics::DrawCanvas(const uint16_t _canvasID, const Rectangle _destination)
+{
+	submitBatch();
+	SDL_RenderCopy(m_renderer, m_canvases[_canvasID], NULL, &convertRect(_destination));
 }
 
 /// <summary> Loads the font from the given path to the given ID at the given font size in points. </summary>
@@ -391,25 +342,139 @@ void Graphics::SDLGraphics::LoadFontToID(const std::string _fileName, const uint
 	// If the font has not loaded correctly, throw an error.
 	if (loadedFont == nullptr) { throw std::exception("Given font does not exist or could not be loaded."); }
 
-	// Add the font to the map.
-	m_fonts.emplace(_fontID, loadedFont);
+	// Draw the glyphs of the font into its atlas and add it to the map.
+	m_fonts[_fontID].Load(m_renderer, loadedFont);
 }
 
-/// <summary> Creates an <see cref="SDL_Rect"/> using the given X and Y positions along with the dimensions of the given <see cref="SDL_Texture"/>. </summary>
-/// <param name="_x"> The X position. </param>
-/// <param name="_y"> The Y position. </param>
-/// <param name="_texture"> The texture from which the dimensions are used. </param>
-/// <returns> A calculated <see cref="SDL_Rect"/>. </returns>
-SDL_Rect Graphics::SDLGraphics::createRectFromTexture(const int32_t _x, const int32_t _y, SDL_Texture* _texture)
+/// <summary> Draws the given area of the given canvas at the given destination. </summary>
+/// <param name="_canvasID"> The ID of the canvas. </param>
+/// <param name="_destination"> The destination <see cref="Rectangle"/>. </param>
+/// <param name="_source"> The source <see cref="Rectangle"/>. </param>
+void Graphics::SDLGraphics::DrawCanvas(const uint16_t _canvasID, const Rectangle _destination, const Rectangle _source)
 {
-	// Create a rectangle and set each parameter.
-	SDL_Rect rectangle;
-	rectangle.x = _x;
-	rectangle.y = _y;
-	SDL_QueryTexture(_texture, NULL, NULL, &rectangle.w, &rectangle.h);
+	submitBatch();
+	SDL_RenderCopy(m_renderer, m_canvases[_canvasID], &convertRect(_source), &convertRect(_destination));
+}
 
-	// Return the rectangle.
-	return rectangle;
+/// <summary> Creates a blended canvas texture with the given ID, size, format and access, destroying any canvas that already has the ID. </summary>
+/// <param name="_canvasID"> The ID of the canvas. </param>
+/// <param name="_size"> The width and height of the canvas in pixels. </param>
+/// <param name="_format"> The pixel format of the texture. </param>
+/// <param name="_access"> How the texture will be written to. </param>
+void Graphics::SDLGraphics::createCanvas(const uint16_t _canvasID, const Point _size, const uint32_t _format, const SDL_TextureAccess _access)
+{
+	// If a canvas already has this ID, destroy it.
+	if (m_canvases.count(_canvasID) > 0) { SDL_DestroyTexture(m_canvases[_canvasID]); }
+
+	// Create the texture, throwing an error if it could not be made.
+	SDL_Texture* canvas = SDL_CreateTexture(m_renderer, _format, _access, _size.x, _size.y);
+	if (canvas == nullptr) { throw std::exception(SDL_GetError()); }
+	SDL_SetTextureBlendMode(canvas, SDL_BLENDMODE_BLEND);
+
+	m_canvases[_canvasID] = canvas;
+}
+
+/// <summary> Loads the texture with the given filename and stores the centre colour of each of its textures under the given sheet ID. </summary>
+/// <param name="_fileName"> The path of the texture. </param>
+/// <param name="_sheetID"> The ID with which the colours should be saved. </param>
+/// <param name="_tileSize"> The width/height of a single tile, or <c>0</c> to use the given bounds as they are. </param>
+/// <param name="_textureBounds"> The bounds of each texture, which are filled in row by row if a tile size is given. </param>
+/// <returns> The loaded texture. </returns>
+SDL_Texture* Graphics::SDLGraphics::loadSheetTexture(const std::string _fileName, const uint16_t _sheetID, const int32_t _tileSize, std::vector<Rectangle>& _textureBounds)
+{
+	// Load the image into a surface, so that its pixels can be read before it is turned into a texture.
+	SDL_Surface* loadedSurface = IMG_Load(_fileName.c_str());
+
+	// If the loaded surface is null, throw an error.
+	if (loadedSurface == nullptr) { throw std::exception("Given texture does not exist or could not be loaded."); }
+
+	// Convert the surface so that each pixel is laid out the same as a Colour.
+	SDL_Surface* colourSurface = SDL_ConvertSurfaceFormat(loadedSurface, SDL_PIXELFORMAT_RGBA32, 0);
+	SDL_FreeSurface(loadedSurface);
+	if (colourSurface == nullptr) { throw std::exception(SDL_GetError()); }
+
+	// If a tile size was given, split the surface into tiles, going along each row.
+	if (_tileSize > 0)
+	{
+		for (int32_t y = 0; y < colourSurface->h / _tileSize; y++)
+		{
+			for (int32_t x = 0; x < colourSurface->w / _tileSize; x++) { _textureBounds.push_back(Rectangle(x * _tileSize, y * _tileSize, _tileSize, _tileSize)); }
+		}
+	}
+
+	// Save the centre colour of each texture.
+	std::vector<Colour> colours(_textureBounds.size());
+	for (uint32_t i = 0; i < _textureBounds.size(); i++)
+	{
+		int32_t centreX = _textureBounds[i].x + _textureBounds[i].w / 2;
+		int32_t centreY = _textureBounds[i].y + _textureBounds[i].h / 2;
+		colours[i] = *(Colour*)((uint8_t*)colourSurface->pixels + centreY * colourSurface->pitch + centreX * sizeof(Colour));
+	}
+	m_sheetColours[_sheetID] = colours;
+
+	// Create the texture from the surface, then release the surface.
+	SDL_Texture* loadedTexture = SDL_CreateTextureFromSurface(m_renderer, colourSurface);
+	SDL_FreeSurface(colourSurface);
+
+	// If the loaded texture is null, throw an error.
+	if (loadedTexture == nullptr) { throw std::exception("Given texture does not exist or could not be loaded."); }
+	SDL_SetTextureBlendMode(loadedTexture, SDL_BLENDMODE_BLEND);
+
+	return loadedTexture;
+}
+
+/// <summary> Draws the given area of the given sheet to the given destination, or adds it to the batch of the sheet if a batch has been started. </summary>
+/// <param name="_sheetID"> The ID of the sheet. </param>
+/// <param name="_source"> The area of the sheet to draw. </param>
+/// <param name="_destination"> The destination on the window. </param>
+/// <param name="_angle"> The rotation in degrees. </param>
+void Graphics::SDLGraphics::drawSprite(const uint16_t _sheetID, const SDL_Rect _source, const SDL_Rect _destination, const double_t _angle)
+{
+	// If a batch has been started, add the sprite to the batch of its sheet, keeping track of the order in which the sheets were first used.
+	if (m_isBatching)
+	{
+		std::vector<BatchedSprite>& batch = m_batches[_sheetID];
+		if (batch.empty()) { m_batchOrder.push_back(_sheetID); }
+		batch.push_back({ _source, _destination, _angle });
+		return;
+	}
+
+	// Otherwise, draw the sprite straight away, only using the slower rotated copy if it is actually rotated.
+	if (_angle == 0) { SDL_RenderCopy(m_renderer, m_sheets[_sheetID], &_source, &_destination); }
+	else { SDL_RenderCopyEx(m_renderer, m_sheets[_sheetID], &_source, &_destination, _angle, NULL, SDL_FLIP_NONE); }
+}
+
+/// <summary> Draws every batched sprite one sheet at a time, in the order that the sheets were first used, then empties the batches while keeping their memory. </summary>
+void Graphics::SDLGraphics::submitBatch()
+{
+	for (size_t i = 0; i < m_batchOrder.size(); i++)
+	{
+		// Get the sheet texture once for the whole batch.
+		SDL_Texture* sheet = m_sheets[m_batchOrder[i]];
+		std::vector<BatchedSprite>& batch = m_batches[m_batchOrder[i]];
+
+		// This version of SDL has no way to submit many quads in one call, so each is copied in turn from the same sheet texture.
+		for (size_t j = 0; j < batch.size(); j++)
+		{
+			if (batch[j].m_angle == 0) { SDL_RenderCopy(m_renderer, sheet, &batch[j].m_source, &batch[j].m_destination); }
+			else { SDL_RenderCopyEx(m_renderer, sheet, &batch[j].m_source, &batch[j].m_destination, batch[j].m_angle, NULL, SDL_FLIP_NONE); }
+		}
+
+		batch.clear();
+	}
+
+	m_batchOrder.clear();
+}
+
+/// <summary> Converts the given area of the given texture into an area of its sheet. </summary>
+/// <param name="_sheetID"> The ID of the sheet from which the texture is stored. </param>
+/// <param name="_textureID"> The ID of the texture itself. </param>
+/// <param name="_source"> The area relative to the top-left of the texture. </param>
+/// <returns> The area relative to the top-left of the sheet. </returns>
+SDL_Rect Graphics::SDLGraphics::getSheetSource(const uint16_t _sheetID, const uint16_t _textureID, const Rectangle _source)
+{
+	Rectangle bounds = m_spriteBounds[_sheetID][_textureID];
+	return createRect(bounds.x + _source.x, bounds.y + _source.y, _source.w, _source.h);
 }
 
 /// <summary> Creates an <see cref="SDL_Rect"/> from the given values. </summary>
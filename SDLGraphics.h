@@ -15,6 +15,7 @@
 
 // Service includes.
 #include "Logger.h"
+#include "SDLFont.h"
 
 // Utility includes.
 #include <map>
@@ -53,21 +54,79 @@ namespace Graphics
 
 		virtual void Draw(uint16_t, uint16_t, Rectangle, Rectangle, float_t);
 
+		virtual void BeginBatch();
+
+		virtual void EndBatch();
+
 		virtual void DrawString(uint16_t, std::string, Point, Colour);
 
 		virtual void DrawString(uint16_t, std::string, Rectangle, Colour);
 
+		virtual void CreateCanvas(uint16_t, Point);
+
+		virtual void CreateTargetCanvas(uint16_t, Point);
+
+		/// <summary> Makes every following draw and clear go to the given canvas instead of the screen, until <see cref="EndCanvasDraw"/> is called. </summary>
+		/// <param name="_canvasID"> The ID of the canvas, which must have been made with <see cref="CreateTargetCanvas"/>. </param>
+		virtual void BeginCanvasDraw(const uint16_t _canvasID)	{ submitBatch(); SDL_SetRenderTarget(m_renderer, m_canvases[_canvasID]); }
+
+		/// <summary> Makes every following draw and clear go to the screen again. </summary>
+		virtual void EndCanvasDraw()							{ submitBatch(); SDL_SetRenderTarget(m_renderer, NULL); }
+
+		virtual void SetCanvasPixels(uint16_t, Rectangle, const Colour*);
+
+		virtual void DrawCanvas(uint16_t, Rectangle);
+
+		virtual void DrawCanvas(uint16_t, Rectangle, Rectangle);
+
+		/// <summary> Gets the colour of the centre of the given texture from the given sheet, which can stand in for the texture when drawn as a single pixel. </summary>
+		/// <param name="_sheetID"> The ID of the sheet from which the texture is stored. </param>
+		/// <param name="_textureID"> The ID of the texture itself. </param>
+		/// <returns> The colour of the centre pixel of the texture. </returns>
+		virtual Colour GetSpriteColour(const uint16_t _sheetID, const uint16_t _textureID) { return m_sheetColours[_sheetID][_textureID]; }
+
 		void LoadSheetToID(std::string, uint16_t, int32_t);
 
 		void LoadSheetToID(std::string, uint16_t, std::vector<Rectangle>);
 
 		void LoadFontToID(std::string, uint16_t, uint8_t);
 	private:
-		/// <summary> The texture vectors keyed by sheet ID. </summary>
-		std::map<uint16_t, std::vector<SDL_Texture*>>	m_sheets;
+		/// <summary> Represents a sprite draw that is waiting to be submitted with the rest of its sheet. </summary>
+		struct BatchedSprite
+		{
+			/// <summary> The area of the sheet to draw. </summary>
+			SDL_Rect	m_source;
+
+			/// <summary> The destination on the window. </summary>
+			SDL_Rect	m_destination;
+
+			/// <summary> The rotation in degrees. </summary>
+			double_t	m_angle;
+		};
+
+		/// <summary> The whole sheet textures keyed by sheet ID. </summary>
+		std::map<uint16_t, SDL_Texture*>				m_sheets;
+
+		/// <summary> The area of each texture within its sheet, keyed by sheet ID. </summary>
+		std::map<uint16_t, std::vector<Rectangle>>		m_spriteBounds;
+
+		/// <summary> The centre colour of each texture, keyed by sheet ID. </summary>
+		std::map<uint16_t, std::vector<Colour>>			m_sheetColours;
+
+		/// <summary> The canvases keyed by canvas ID. </summary>
+		std::map<uint16_t, SDL_Texture*>				m_canvases;
 
 		/// <summary> The fonts keyed by font ID. </summary>
-		std::map<uint16_t, TTF_Font*>					m_fonts;
+		std::map<uint16_t, SDLFont>						m_fonts;
+
+		/// <summary> The sprite draws waiting to be submitted, keyed by sheet ID. </summary>
+		std::map<uint16_t, std::vector<BatchedSprite>>	m_batches;
+
+		/// <summary> The IDs of the sheets with waiting sprite draws, in the order they were first drawn from. </summary>
+		std::vector<uint16_t>							m_batchOrder;
+
+		/// <summary> <c>true</c> if sprite draws are being collected into batches; otherwise, <c>false</c>. </summary>
+		bool											m_isBatching;
 
 		/// <summary> The renderer. </summary>
 		SDL_Renderer*									m_renderer;
@@ -75,7 +134,16 @@ namespace Graphics
 		/// <summary> The window. </summary>
 		SDL_Window*										m_window;
 
-		SDL_Rect createRectFromTexture(int32_t, int32_t, SDL_Texture*);
+		void createCanvas(uint16_t, Point, uint32_t, SDL_TextureAccess);
+
+		SDL_Texture* loadSheetTexture(std::string, uint16_t, int32_t, std::vector<Rectangle>&);
+
+		void drawSprite(uint16_t, SDL_Rect, SDL_Rect, double_t);
+
+		void submitBatch();
+
+		SDL_Rect getSheetSource(uint16_t, uint16_t, Rectangle);
+
 		SDL_Rect createRect(int32_t, int32_t, int32_t, int32_t);
 		SDL_Rect convertRect(Rectangle);
 	};
@@ -0,0 +1,131 @@
+#include "ScriptedEvents.h"
+
+// Data includes.
+#include "WallGem.h"
+
+/// <summary> Pumps every event in the queue, including any pushed while pumping, and fires any bound events. </summary>
+/// <param name="_currentGameState"> The current state of the game. </param>
+/// <param name="_services"> The service provider. </param>
+void Events::ScriptedEvents::PumpEvents(const MainGame::GameState _currentGameState, Services::ServiceProvider& _services)
+{
+	while (!m_queuedEvents.empty())
+	{
+		// Take the event off the front of the queue, so that events pushed by listeners go after it.
+		QueuedEvent currentEvent = m_queuedEvents.front();
+		m_queuedEvents.pop_front();
+
+		// Create an EventContext to hold the data.
+		EventContext eventContext(_currentGameState, _services);
+
+		// Handle user events then delete the data.
+		if (currentEvent.m_isUserEvent)
+		{
+			if (m_functionsByUserEvent.count(currentEvent.m_eventID) > 0) { fireEvents(m_functionsByUserEvent[currentEvent.m_eventID], eventContext.SetData(currentEvent.m_data1, currentEvent.m_data2)); }
+			deleteData((UserEvent)currentEvent.m_eventID, currentEvent.m_data1, currentEvent.m_data2);
+			continue;
+		}
+
+		// If no functions are bound to this framework event, skip it.
+		if (m_functionsByFrameworkEventID.count(currentEvent.m_eventID) == 0) { continue; }
+		std::vector<std::function<void(EventContext*)>>& eventFunctions = m_functionsByFrameworkEventID[currentEvent.m_eventID];
+
+		// Handle framework events, giving the same data as SDL's events would.
+		switch (currentEvent.m_eventID)
+		{
+		case SDL_QUIT: { fireEvents(eventFunctions, eventContext.SetData(NULL, NULL)); break; }
+		case SDL_MOUSEBUTTONDOWN: { fireEvents(eventFunctions, eventContext.SetData(&currentEvent.m_x, &currentEvent.m_y)); break; }
+		case SDL_KEYDOWN: { fireEvents(eventFunctions, eventContext.SetData(&currentEvent.m_scancode, &currentEvent.m_modifiers)); break; }
+		}
+	}
+}
+
+/// <summary> Creates an event with the given ID and data, then adds it to the back of the queue. </summary>
+/// <param name="_eventID"> The ID of the user event. </param>
+/// <param name="_data1"> The first data to be put into the event. </param>
+/// <param name="_data2"> The second data to be put into the event. </param>
+/// <remarks> Data is not copied and is used as-is, and will be deleted as the type pushed with the given event when the event is read. Due to this, is it recommended to pass a copy of the data in. </remarks>
+void Events::ScriptedEvents::PushEvent(const UserEvent _eventID, void* _data1, void* _data2)
+{
+	QueuedEvent newEvent = QueuedEvent();
+	newEvent.m_eventID = _eventID;
+	newEvent.m_isUserEvent = true;
+	newEvent.m_data1 = _data1;
+	newEvent.m_data2 = _data2;
+	m_queuedEvents.push_back(newEvent);
+}
+
+/// <summary> Deletes the data of a fired user event as the type that is pushed with that event, so that its destructor and deallocation match how it was created. </summary>
+/// <param name="_eventID"> The ID of the user event. </param>
+/// <param name="_data1"> The first data of the event. </param>
+/// <param name="_data2"> The second data of the event. </param>
+void Events::ScriptedEvents::deleteData(const UserEvent _eventID, void* _data1, void* _data2)
+{
+	switch (_eventID)
+	{
+	// The world pushes the cell that was mined and its prosperity.
+	case UserEvent::StartMinigame:	{ delete static_cast<Point*>(_data1); delete static_cast<uint8_t*>(_data2); break; }
+
+	// The minigame pushes the cell that was mined.
+	case UserEvent::StopMinigame:	{ delete static_cast<Point*>(_data1); break; }
+
+	// The minigame pushes the maximum and current collapse timer.
+	case UserEvent::MinedWall:		{ delete static_cast<uint16_t*>(_data1); delete static_cast<uint16_t*>(_data2); break; }
+
+	// The minigame pushes the gem that was uncovered.
+	case UserEvent::MinedGem:		{ delete static_cast<Minigames::WallGem*>(_data1); break; }
+
+	// Buttons push the data they were given, and the tool keys push the same so that either can change the tool.
+	case UserEvent::ChangeTool:
+	case UserEvent::StartGame:
+	case UserEvent::QuitGame:
+	case UserEvent::MainMenu:
+	case UserEvent::HelpScreen:		{ delete static_cast<int32_t*>(_data1); delete static_cast<int32_t*>(_data2); break; }
+
+	// The rest never have data.
+	default:						{ break; }
+	}
+}
+
+/// <summary> Adds a key press of the given key to the back of the queue. </summary>
+/// <param name="_scancode"> The key that was pressed. </param>
+void Events::ScriptedEvents::PushKeyDown(const SDL_Scancode _scancode)
+{
+	pushFrameworkEvent(SDL_KEYDOWN, _scancode, 0, 0);
+}
+
+/// <summary> Adds a mouse click at the given position to the back of the queue. </summary>
+/// <param name="_windowPosition"> The position of the click in window space. </param>
+void Events::ScriptedEvents::PushMouseDown(const Point _windowPosition)
+{
+	pushFrameworkEvent(SDL_MOUSEBUTTONDOWN, SDL_SCANCODE_UNKNOWN, _windowPosition.x, _windowPosition.y);
+}
+
+/// <summary> Adds a quit request to the back of the queue. </summary>
+void Events::ScriptedEvents::PushQuit()
+{
+	pushFrameworkEvent(SDL_QUIT, SDL_SCANCODE_UNKNOWN, 0, 0);
+}
+
+/// <summary> Adds a framework event with the given values to the back of the queue. </summary>
+/// <param name="_eventID"> The ID of the SDL event. </param>
+/// <param name="_scancode"> The key of a key event. </param>
+/// <param name="_x"> The x position of a mouse event. </param>
+/// <param name="_y"> The y position of a mouse event. </param>
+void Events::ScriptedEvents::pushFrameworkEvent(const uint32_t _eventID, const SDL_Scancode _scancode, const int32_t _x, const int32_t _y)
+{
+	QueuedEvent newEvent = QueuedEvent();
+	newEvent.m_eventID = _eventID;
+	newEvent.m_isUserEvent = false;
+	newEvent.m_scancode = _scancode;
+	newEvent.m_x = _x;
+	newEvent.m_y = _y;
+	m_queuedEvents.push_back(newEvent);
+}
+
+/// <summary> Fires every function bound an event with the given data. </summary>
+/// <param name="_functions"> The functions bound to the event. </param>
+/// <param name="_context"> The context of the event. </param>
+void Events::ScriptedEvents::fireEvents(std::vector<std::function<void(EventContext*)>>& _functions, EventContext& _context)
+{
+	for (uint32_t i = 0; i < _functions.size(); i++) { _functions[i](&_context); }
+}
@@ -0,0 +1,89 @@
+#ifndef SCRIPTEDEVENTS_H
+#define SCRIPTEDEVENTS_H
+
+// Derived includes.
+#include "Events.h"
+
+// Framework includes.
+#include <SDL_events.h>
+
+// Data includes.
+#include "Point.h"
+
+// Utility includes.
+#include "GameState.h"
+#include <vector>
+#include <map>
+#include <deque>
+
+namespace Events
+{
+	/// <summary> Represents an event bus that is fed input directly instead of from a window, so that the game can run without a display. </summary>
+	/// <remarks> Framework events use the same IDs as SDL's events, so that everything listening for them works unchanged. </remarks>
+	class ScriptedEvents : public Events
+	{
+	public:
+		ScriptedEvents() : m_functionsByFrameworkEventID(std::map<uint32_t, std::vector<std::function<void(EventContext*)>>>()), m_functionsByUserEvent(std::map<uint32_t, std::vector<std::function<void(EventContext*)>>>()), m_queuedEvents(std::deque<QueuedEvent>()) { }
+
+		void PumpEvents(MainGame::GameState, Services::ServiceProvider&);
+
+		virtual void PushEvent(UserEvent, void*, void*);
+
+		void PushKeyDown(SDL_Scancode);
+
+		void PushMouseDown(Point);
+
+		void PushQuit();
+
+		/// <summary> Adds a function that will be called when the given user event is fired. </summary>
+		/// <param name="_userEvent"> The user event. </param>
+		/// <param name="_function"> The function to be called. </param>
+		virtual void AddUserListener(const UserEvent _userEvent, std::function<void(EventContext*)> _function) { m_functionsByUserEvent[_userEvent].push_back(_function); }
+
+		/// <summary> Adds a function that will be called when the given framework event is fired. </summary>
+		/// <param name="_frameworkEventID"> The ID of the SDL event. </param>
+		/// <param name="_function"> The function to be called. </param>
+		virtual void AddFrameworkListener(const uint32_t _frameworkEventID, std::function<void(EventContext*)> _function) { m_functionsByFrameworkEventID[_frameworkEventID].push_back(_function); }
+	private:
+		/// <summary> Represents an event waiting to be pumped, holding the values its data points to. </summary>
+		struct QueuedEvent
+		{
+			/// <summary> The ID of the user or framework event. </summary>
+			uint32_t		m_eventID;
+
+			/// <summary> <c>true</c> if this is a user event; otherwise, <c>false</c>. </summary>
+			bool			m_isUserEvent;
+
+			/// <summary> The first data of a user event, which is deleted as the type pushed with its event once the event is fired. </summary>
+			void*			m_data1;
+
+			/// <summary> The second data of a user event, which is deleted as the type pushed with its event once the event is fired. </summary>
+			void*			m_data2;
+
+			/// <summary> The key of a key event. </summary>
+			SDL_Scancode	m_scancode;
+
+			/// <summary> The modifier keys of a key event. </summary>
+			uint16_t		m_modifiers;
+
+			/// <summary> The position of a mouse event in window space. </summary>
+			int32_t			m_x, m_y;
+		};
+
+		/// <summary> Vectors of functions keyed by SDL event IDs. </summary>
+		std::map<uint32_t, std::vector<std::function<void(EventContext*)>>>	m_functionsByFrameworkEventID;
+
+		/// <summary> Vectors of functions keyed by user event. </summary>
+		std::map<uint32_t, std::vector<std::function<void(EventContext*)>>>	m_functionsByUserEvent;
+
+		/// <summary> The events waiting to be pumped, in the order they were pushed. </summary>
+		std::deque<QueuedEvent>												m_queuedEvents;
+
+		void pushFrameworkEvent(uint32_t, SDL_Scancode, int32_t, int32_t);
+
+		void fireEvents(std::vector<std::function<void(EventContext*)>>&, EventContext&);
+
+		static void deleteData(UserEvent, void*, void*);
+	};
+}
+#endif
@@ -7,7 +7,7 @@
 namespace Services
 {
 	/// <summary> Represents the type of service to get or set. </summary>
-	enum ServiceType { Logger, Graphics, Controls, Screen, Events, Audio, Time, Particles };
+	enum ServiceType { Logger, Graphics, Controls, Screen, Events, Audio, Time, Particles, Random };
 
 	/// <summary> Represents a service provider which allows for services to be accessed. </summary>
 	class ServiceProvider
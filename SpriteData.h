@@ -22,6 +22,9 @@ namespace SpriteData
 	/// <summary> The ID of each UI element. </summary>
 	enum UIID { SideBar = 0, MinigameBar, WallTimer, Pickaxe, Shovel, Hammer, InventoryFrame, RubyIcon, DiamondIcon, SapphireIcon, EmeraldIcon, MenuBackground, PlayButton, HelpButton, QuitButton, BackButton, MenuButton, HelpScreen, DeathScreen };
 
+	/// <summary> The ID of each canvas, where <c>CameraChunks</c> is the first of the range used by the <see cref="Camera"/>. </summary>
+	enum CanvasID { MinimapTiles = 0, CameraChunks };
+
 	/// <summary> The ID of each font. </summary>
 	enum FontID { Menu = 0, SmallDetail };
 
@@ -58,11 +61,13 @@ namespace SpriteData
 	inline bool		IsFloor(const uint16_t _ID)		{ return _ID >= (int32_t)TileID::Floor1		&& _ID <= (int32_t)TileID::Floor4; }
 
 	/// <summary> Gets a randomly generated plain wall. </summary>
+	/// <param name="_random"> The random stream to use. </param>
 	/// <returns> A randomly generated plain wall. </returns>
-	inline TileID	GetRandomPlainWall()					{ return (TileID)((int32_t)TileID::Wall1 + Random::RandomBetween(0, (int32_t)TileID::Wall4)); }
+	inline TileID	GetRandomPlainWall(Random::RandomStream& _random)	{ return (TileID)((int32_t)TileID::Wall1 + _random.Between(0, (int32_t)TileID::Wall4)); }
 
 	/// <summary> Gets a randomly generated floor. </summary>
+	/// <param name="_random"> The random stream to use. </param>
 	/// <returns> A randomly generated floor. </returns>
-	inline TileID	GetRandomFloor()						{ return (TileID)(TileID::Floor1 + Random::RandomBetween(0, (int32_t)TileID::Wall4)); }
+	inline TileID	GetRandomFloor(Random::RandomStream& _random)		{ return (TileID)(TileID::Floor1 + _random.Between(0, (int32_t)TileID::Wall4)); }
 }
 #endif
\ No newline at end of file
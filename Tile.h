@@ -21,6 +21,12 @@ namespace WorldObjects
 
 		/// <summary> Creates a blank tile. </summary>
 		Tile() : m_ID(0), m_prosperity(0), m_visibility(false) {}
+
+		/// <summary> Creates a tile with the given values. </summary>
+		/// <param name="_ID"> The ID. </param>
+		/// <param name="_prosperity"> The prosperity level. </param>
+		/// <param name="_visibility"> The visibility. </param>
+		Tile(const uint8_t _ID, const uint8_t _prosperity, const bool _visibility) : m_ID(_ID), m_prosperity(_prosperity), m_visibility(_visibility) {}
 	};
 }
 #endif
\ No newline at end of file
@@ -1,50 +1,16 @@
 #include "TileMap.h"
 
+// Utility includes.
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <exception>
+#include <utility>
+
 /// <summary> Creates a new <see cref="TileMap"/> with the given width and height. </summary>
 /// <param name="_width"> The width of the data. </param>
 /// <param name="_height"> The height of the data. </param>
-WorldObjects::TileMap::TileMap(const uint16_t _width, const uint16_t _height) : m_width(_width), m_height(_height)
-{
-	// Initialise the rows and columns.
-	m_data = std::vector<std::vector<Tile>>(m_width);
-	for (int32_t x = 0; x < m_width; x++) { m_data[x] = std::vector<Tile>(m_height); }
-}
-
-/// <summary> Finds if the given area is floored. </summary>
-/// <param name="_area"> The area to check. </param>
-/// <returns> <c>true</c> if not a single blocked cell exists within the given area, <c>false</c> otherwise. </returns>
-bool WorldObjects::TileMap::AreaIsClear(const Rectangle _area)
-{
-	// Check each cell in the area, if any are blocked, return false.
-	for (int32_t x = _area.x; x < _area.GetMaxX(); x++)
-	{
-		for (int32_t y = _area.y; y < _area.GetMaxY(); y++) 
-		{
-			if (IsCellBlockedAndInRange(Point(x, y))) { return false; }
-		}
-	}
-
-	// If every cell is clear, the area is clear.
-	return true;
-}
-
-/// <summary> Finds if the given area is walled. </summary>
-/// <param name="_area"> The area to check. </param>
-/// <returns> <c>true</c> if not a single clear cell exists within the given area, <c>false</c> otherwise. </returns>
-bool WorldObjects::TileMap::AreaIsBlocked(const Rectangle _area)
-{
-	// Check each cell in the area, if any are clear, return false.
-	for (int32_t x = _area.x; x < _area.GetMaxX(); x++)
-	{
-		for (int32_t y = _area.y; y < _area.GetMaxY(); y++)
-		{
-			if (IsCellClearAndInRange(Point(x, y))) { return false; } 
-		}
-	}
-
-	// If every cell is blocked, the area is blocked.
-	return true;
-}
+WorldObjects::TileMap::TileMap(const uint32_t _width, const uint32_t _height) : m_data(_width, _height) { }
 
 /// <summary> Fills the cell at the given position with the given ID. </summary>
 /// <param name="_position"> The position of the cell. </param>
@@ -52,11 +18,16 @@ bool WorldObjects::TileMap::AreaIsBlocked(const Rectangle _area)
 void WorldObjects::TileMap::FillCell(const Point _position, const uint16_t _ID)
 {
 	// If the cell is out of range, do nothing.
-	if (!IsCellInRange(_position)) { return; }
+	if (!GetView().IsCellInRange(_position)) { return; }
+
+	// If the cell already has this ID and no prosperity, do nothing so that it is not marked as dirty.
+	if (m_data.GetID(_position.x, _position.y) == _ID && m_data.GetProsperity(_position.x, _position.y) == 0) { return; }
 
 	// Fill the cell at the given position with the given ID, also set the prosperity to 0 as floors cannot be mined.
-	m_data[_position.x][_position.y].m_ID = _ID;
-	SetCellProsperity(_position, 0);
+	m_data.SetID(_position.x, _position.y, (uint8_t)_ID);
+	m_data.SetProsperity(_position.x, _position.y, 0);
+	m_clearCells.SetCell(_position, SpriteData::IsFloor((uint8_t)_ID));
+	markDirty(Rectangle(_position, Point(1, 1)));
 }
 
 /// <summary> Sets the prosperity of the given cell with the given value. </summary>
@@ -65,10 +36,14 @@ void WorldObjects::TileMap::FillCell(const Point _position, const uint16_t _ID)
 void WorldObjects::TileMap::SetCellProsperity(const Point _position, const uint8_t _prosperity)
 {
 	// If the cell is out of range, do nothing.
-	if (!IsCellInRange(_position)) { return; }
+	if (!GetView().IsCellInRange(_position)) { return; }
+
+	// If the prosperity is unchanged, do nothing so that the cell is not marked as dirty.
+	if (m_data.GetProsperity(_position.x, _position.y) == _prosperity) { return; }
 
-	// Fill the cell at the given position with the given ID.
-	m_data[_position.x][_position.y].m_prosperity = _prosperity;
+	// Set the prosperity of the cell at the given position with the given value.
+	m_data.SetProsperity(_position.x, _position.y, _prosperity);
+	markDirty(Rectangle(_position, Point(1, 1)));
 }
 
 /// <summary> Sets the visibility of the given cell with the given value. </summary>
@@ -77,10 +52,14 @@ void WorldObjects::TileMap::SetCellProsperity(const Point _position, const uint8
 void WorldObjects::TileMap::SetCellVisiblity(const Point _position, const bool _visibility)
 {
 	// If the cell is out of range, do nothing.
-	if (!IsCellInRange(_position)) { return; }
+	if (!GetView().IsCellInRange(_position)) { return; }
+
+	// If the visibility is unchanged, do nothing so that the cell is not marked as dirty.
+	if (m_data.GetVisibility(_position.x, _position.y) == _visibility) { return; }
 
 	// Set the visibility of the cell at the given position with the given value.
-	m_data[_position.x][_position.y].m_visibility = _visibility;
+	m_data.SetVisibility(_position.x, _position.y, _visibility);
+	markDirty(Rectangle(_position, Point(1, 1)));
 }
 
 /// <summary> Fills every cell within the given area with the given ID. </summary>
@@ -89,53 +68,115 @@ void WorldObjects::TileMap::SetCellVisiblity(const Point _position, const bool _
 /// <param name="_ID"> The ID with which to fill the area. </param>
 void WorldObjects::TileMap::FillArea(const Rectangle _area, const uint16_t _ID)
 {
-	for (int32_t x = _area.x; x < _area.GetMaxX(); x++)
-	{
-		for (int32_t y = _area.y; y < _area.GetMaxY(); y++)
-		{
-			FillCell(Point(x, y), _ID); 
-		}
-	}
+	fillArea(_area, [_ID]() { return _ID; });
 }
 
 /// <summary> Fills every cell within the given area with a random floor. </summary>
 /// <param name="_position"> The top-left corner of the area to fill. </param>
 /// <param name="_size"> The size of the area to fill. </param>
-void WorldObjects::TileMap::FillAreaWithRandomFloor(const Rectangle _area)
+/// <param name="_random"> The random stream to use. </param>
+void WorldObjects::TileMap::FillAreaWithRandomFloor(const Rectangle _area, Random::RandomStream& _random)
 {
-	for (int32_t x = _area.x; x < _area.GetMaxX(); x++)
-	{
-		for (int32_t y = _area.y; y < _area.GetMaxY(); y++)
-		{
-			FillCellWithRandomFloor(Point(x, y)); 
-		}
-	}
+	fillArea(_area, [&_random]() { return SpriteData::GetRandomFloor(_random); });
 }
 
 /// <summary> Fills every cell within the given area with a random wall. </summary>
 /// <param name="_position"> The top-left corner of the area to fill. </param>
 /// <param name="_size"> The size of the area to fill. </param>
-void WorldObjects::TileMap::FillAreaWithRandomWall(const Rectangle _area)
+/// <param name="_random"> The random stream to use. </param>
+void WorldObjects::TileMap::FillAreaWithRandomWall(const Rectangle _area, Random::RandomStream& _random)
 {
-	for (int32_t x = _area.x; x < _area.GetMaxX(); x++)
-	{
-		for (int32_t y = _area.y; y < _area.GetMaxY(); y++)
-		{
-			FillCellWithRandomWall(Point(x, y)); 
-		}
-	}
+	fillArea(_area, [&_random]() { return SpriteData::GetRandomPlainWall(_random); });
 }
 
 /// <summary> Resets the data. </summary>
 void WorldObjects::TileMap::Reset()
 {
-	for (int32_t x = 0; x < m_width; x++)
+	// Release every chunk, which turns every cell into an undiscovered plain wall without needing to touch them.
+	m_data.Clear();
+	m_clearCells.Invalidate();
+
+	// Every cell may have changed.
+	markDirty(Rectangle(0, 0, m_data.GetWidth(), m_data.GetHeight()));
+}
+
+/// <summary> Swaps the cells of this map with those of the given map of the same size, without copying any cells. </summary>
+/// <param name="_other"> The map to swap with, which keeps its own consumers. </param>
+void WorldObjects::TileMap::SwapTiles(TileMap& _other)
+{
+	// If the maps are not the same size, the cells cannot be swapped.
+	if (m_data.GetWidth() != _other.m_data.GetWidth() || m_data.GetHeight() != _other.m_data.GetHeight()) { throw std::exception("Cannot swap the tiles of maps of different sizes."); }
+
+	// Swap the chunks and the clear cells, then mark both maps as entirely changed.
+	std::swap(m_data, _other.m_data);
+	std::swap(m_clearCells, _other.m_clearCells);
+	markDirty(Rectangle(0, 0, m_data.GetWidth(), m_data.GetHeight()));
+	_other.markDirty(Rectangle(0, 0, _other.m_data.GetWidth(), _other.m_data.GetHeight()));
+}
+
+/// <summary> Registers a new consumer of the areas that change, such as a renderer that keeps its output between frames. </summary>
+/// <returns> The ID of the consumer, which starts with the entire map dirty. </returns>
+uint32_t WorldObjects::TileMap::RegisterDirtyConsumer()
+{
+	// The consumer has not yet seen anything, so it starts with the entire map dirty.
+	m_dirtyRegions.push_back(DirtyRegions());
+	m_dirtyRegions.back().MarkArea(Rectangle(0, 0, m_data.GetWidth(), m_data.GetHeight()));
+
+	return (uint32_t)m_dirtyRegions.size() - 1;
+}
+
+/// <summary> Marks the given area as dirty for every consumer. </summary>
+/// <param name="_area"> The changed area. </param>
+void WorldObjects::TileMap::markDirty(const Rectangle _area)
+{
+	for (size_t i = 0; i < m_dirtyRegions.size(); i++) { m_dirtyRegions[i].MarkArea(_area); }
+}
+
+/// <summary> Fills every cell within the given area with an ID from the given function, the same as filling each cell in turn, but writing each row a run at a time. </summary>
+/// <param name="_area"> The area to fill, which is clipped to the map. </param>
+/// <param name="_getID"> The function that gives the ID of each cell, which is called once for every cell within the map going along each row. </param>
+template <class GetID> void WorldObjects::TileMap::fillArea(const Rectangle _area, GetID _getID)
+{
+	// The corners of every cell that changed, so that only they are marked as dirty.
+	Point changedMin(INT32_MAX, INT32_MAX), changedMax(INT32_MIN, INT32_MIN);
+
+	Rectangle clippedArea = GetView().ClipToMap(_area);
+	uint8_t IDs[TileStorage::c_chunkSize];
+	for (int32_t y = clippedArea.y; y < clippedArea.GetMaxY(); y++)
 	{
-		for (int32_t y = 0; y < m_height; y++) 
+		for (int32_t x = clippedArea.x; x < clippedArea.GetMaxX(); x += TileStorage::GetRunLength(x, clippedArea.GetMaxX()))
 		{
-			FillCellWithRandomWall(Point(x, y));
-			SetCellProsperity(Point(x, y), 0);
-			SetCellVisiblity(Point(x, y), false);
+			// Take the ID of each cell of the run first, so that an untouched chunk is only allocated if the run would change it.
+			int32_t length = TileStorage::GetRunLength(x, clippedArea.GetMaxX());
+			for (int32_t i = 0; i < length; i++) { IDs[i] = (uint8_t)_getID(); }
+			if (m_data.GetIDRun(x, y) == NULL && std::memcmp(IDs, TileStorage::GetUntouchedIDRun(x, y), length) == 0) { continue; }
+
+			TileStorage::WritableTileRun run = m_data.GetWritableTileRun(x, y);
+			for (int32_t i = 0; i < length; i++)
+			{
+				// If the cell already has this ID and no prosperity, leave it so that it is not marked as dirty.
+				if (run.m_IDs[i] == IDs[i] && run.m_prosperities[i] == 0) { continue; }
+
+				// Fill the cell, also setting the prosperity to 0 as floors cannot be mined.
+				bool wasClear = SpriteData::IsFloor(run.m_IDs[i]);
+				run.m_IDs[i] = IDs[i];
+				run.m_prosperities[i] = 0;
+				if (wasClear != SpriteData::IsFloor(IDs[i])) { m_clearCells.SetCell(Point(x + i, y), !wasClear); }
+
+				changedMin = Point(std::min(changedMin.x, x + i), std::min(changedMin.y, y));
+				changedMax = Point(std::max(changedMax.x, x + i), std::max(changedMax.y, y));
+			}
 		}
 	}
+
+	// Mark the bounds of every changed cell as dirty at once.
+	if (changedMax.x >= changedMin.x) { markDirty(Rectangle(changedMin, changedMax - changedMin + Point(1, 1))); }
+}
+
+/// <summary> Gets the index of clear cells, building it if the map has been reset since it was last used. </summary>
+/// <returns> The up to date index. </returns>
+WorldObjects::ClearCellIndex& WorldObjects::TileMap::getClearCells()
+{
+	if (!m_clearCells.IsBuilt()) { m_clearCells.Build(GetView()); }
+	return m_clearCells;
 }
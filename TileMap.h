@@ -6,12 +6,15 @@
 
 // Data includes.
 #include "Tile.h"
+#include "TileStorage.h"
+#include "TileMapView.h"
+#include "DirtyRegions.h"
+#include "ClearCellIndex.h"
 #include "Point.h"
 #include "Rectangle.h"
 
 // Utility includes.
 #include "SpriteData.h"
-#include <vector>
 
 // Typedef includes.
 #include <stdint.h>
@@ -19,74 +22,107 @@
 namespace WorldObjects
 {
 	/// <summary> Represents a 2D <see cref="Tile"/>-based map. </summary>
+	/// <remarks> The <see cref="IReadOnlyTileMap"/> functions are a thin adapter over the <see cref="View"/>, which should be used instead wherever cells are queried in bulk. </remarks>
 	class TileMap : public IReadOnlyTileMap
 	{
 	public:
-		TileMap(uint16_t, uint16_t);
+		/// <summary> The compile-time view type over the data of a <see cref="TileMap"/>. </summary>
+		typedef TileMapView<TileStorage> View;
+
+		TileMap(uint32_t, uint32_t);
 
 		TileMap(TileMap&) = delete;
 		TileMap& operator=(const TileMap&) = delete;
 
+		/// <summary> Gets a read-only view of the data, which is resolved at compile time. </summary>
+		/// <returns> A <see cref="View"/> of the data, which stays valid for as long as this map exists. </returns>
+		inline View			GetView()								const	{ return View(m_data); }
+
 		/// <summary> Gets the width of the data. </summary>
 		/// <returns> The width of the data. </returns>
-		virtual uint16_t	GetWidth()										{ return m_width; }
+		virtual uint32_t	GetWidth()										{ return GetView().GetWidth(); }
 
 		/// <summary> Gets the height of the data. </summary>
 		/// <returns> The height of the data. </returns>
-		virtual uint16_t	GetHeight()										{ return m_height; }
+		virtual uint32_t	GetHeight()										{ return GetView().GetHeight(); }
 
 		/// <summary> Gets the area of the data. </summary>
 		/// <returns> The width multiplied by the height of the data. </returns>
-		virtual uint16_t	GetArea()										{ return m_width * m_height; }
+		virtual uint32_t	GetArea()										{ return GetView().GetArea(); }
 
 		/// <summary> Gets the <see cref="Tile"/> at the given position. </summary>
 		/// <param name="_position"> The position whence to get the <see cref="Tile"/>. </param>
 		/// <returns> The <see cref="Tile"/> at the given position. </returns>
-		virtual Tile		GetTileAt(const Point _position)				{ return m_data[_position.x][_position.y]; }
+		virtual Tile		GetTileAt(const Point _position)				{ return GetView().GetTileAt(_position); }
 
 		/// <summary> Returns <c>true</c> if the given position is in range; otherwise, <c>false</c>. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the given position is in range; otherwise, <c>false</c>. </returns>
-		virtual bool		IsCellInRange(const Point _position)			{ return _position.x >= 0 && _position.x < m_width && _position.y >= 0 && _position.y < m_height; }
+		virtual bool		IsCellInRange(const Point _position)			{ return GetView().IsCellInRange(_position); }
 
 		/// <summary> Returns <c>true</c> if the given position is in the playable range; otherwise, <c>false</c>. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the given position is in the playable range; otherwise, <c>false</c>. </returns>
-		virtual bool		IsCellInPlayableArea(const Point _position)		{ return (_position.x > 0 && _position.x < m_width - 1 && _position.y > 0 && _position.y < m_height - 1); }
+		virtual bool		IsCellInPlayableArea(const Point _position)		{ return GetView().IsCellInPlayableArea(_position); }
 
 		/// <summary> Checks if the <see cref="Tile"/> at the given position is empty. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the given position is empty; otherwise, <c>false</c>. </returns>
-		virtual bool		IsCellClear(const Point _position)				{ return SpriteData::IsFloor(m_data[_position.x][_position.y].m_ID); }
+		virtual bool		IsCellClear(const Point _position)				{ return GetView().IsCellClear(_position); }
 		
 		/// <summary> Checks if the <see cref="Tile"/> at the given position is empty and on the map. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the given position is empty and on the map; otherwise, <c>false</c>. </returns>
-		virtual bool		IsCellClearAndInRange(const Point _position)	{ return IsCellInRange(_position) && IsCellClear(_position); }
+		virtual bool		IsCellClearAndInRange(const Point _position)	{ return GetView().IsCellClearAndInRange(_position); }
 
 		/// <summary> Checks if the <see cref="Tile"/> at the given position is blocked. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the given position is blocked; otherwise, <c>false</c>. </returns>
-		virtual bool		IsCellBlocked(const Point _position)			{ return SpriteData::IsWall(m_data[_position.x][_position.y].m_ID); }
+		virtual bool		IsCellBlocked(const Point _position)			{ return GetView().IsCellBlocked(_position); }
 		
 		/// <summary> Checks if the <see cref="Tile"/> at the given position is blocked and on the map. </summary>
 		/// <param name="_position"> The position to check. </param>
 		/// <returns> <c>true</c> if the given position is blocked and on the map; otherwise, <c>false</c>. </returns>
-		virtual bool		IsCellBlockedAndInRange(const Point _position)	{ return IsCellInRange(_position) && IsCellBlocked(_position); }
+		virtual bool		IsCellBlockedAndInRange(const Point _position)	{ return GetView().IsCellBlockedAndInRange(_position); }
 
-		virtual bool		AreaIsClear(Rectangle);
+		/// <summary> Finds if the given area is floored. </summary>
+		/// <param name="_area"> The area to check. </param>
+		/// <returns> <c>true</c> if not a single blocked cell exists within the given area, <c>false</c> otherwise. </returns>
+		virtual bool		AreaIsClear(const Rectangle _area)				{ return GetView().AreaIsClear(_area); }
 		
-		virtual bool		AreaIsBlocked(Rectangle);
+		/// <summary> Finds if the given area is walled. </summary>
+		/// <param name="_area"> The area to check. </param>
+		/// <returns> <c>true</c> if not a single clear cell exists within the given area, <c>false</c> otherwise. </returns>
+		virtual bool		AreaIsBlocked(const Rectangle _area)			{ return GetView().AreaIsBlocked(_area); }
+
+		virtual uint32_t	RegisterDirtyConsumer();
+
+		/// <summary> Takes the areas that have changed since the given consumer last consumed them. </summary>
+		/// <param name="_consumerID"> The ID of the consumer. </param>
+		/// <returns> The changed areas, none of which overlap. </returns>
+		virtual std::vector<Rectangle> ConsumeDirtyRegions(const uint32_t _consumerID) { return m_dirtyRegions[_consumerID].Consume(); }
+
+		/// <summary> Gets the amount of clear cells within the playable area. </summary>
+		/// <returns> The amount of clear cells. </returns>
+		inline uint32_t		GetClearCellCount()								{ return getClearCells().GetCount(); }
+
+		/// <summary> Gets the clear cell in the given slot, where every clear cell within the playable area has a slot. </summary>
+		/// <param name="_slot"> The slot, from <c>0</c> to <see cref="GetClearCellCount"/>. </param>
+		/// <returns> The position of the clear cell. </returns>
+		/// <remarks> Slots are in no particular order, and change as cells are filled. </remarks>
+		inline Point		GetClearCell(const uint32_t _slot)				{ return getClearCells().GetCell(_slot); }
 
 		void				FillCell(Point, uint16_t);
 		
 		/// <summary> Fills the <see cref="Tile"/> at the given position with a random floor. </summary>
 		/// <param name="_position"> The position to change. </param>
-		inline void			FillCellWithRandomFloor(const Point _position)	{ FillCell(_position, SpriteData::GetRandomFloor()); }
+		/// <param name="_random"> The random stream to use. </param>
+		inline void			FillCellWithRandomFloor(const Point _position, Random::RandomStream& _random)	{ FillCell(_position, SpriteData::GetRandomFloor(_random)); }
 		
 		/// <summary> Fills the <see cref="Tile"/> at the given position with a random wall. </summary>
 		/// <param name="_position"> The position to change. </param>
-		inline void			FillCellWithRandomWall(const Point _position)	{ FillCell(_position, SpriteData::GetRandomPlainWall()); }
+		/// <param name="_random"> The random stream to use. </param>
+		inline void			FillCellWithRandomWall(const Point _position, Random::RandomStream& _random)	{ FillCell(_position, SpriteData::GetRandomPlainWall(_random)); }
 
 		void				SetCellProsperity(Point, uint8_t);
 
@@ -94,20 +130,28 @@ namespace WorldObjects
 
 		void				FillArea(Rectangle, uint16_t);
 		
-		void				FillAreaWithRandomFloor(Rectangle);
+		void				FillAreaWithRandomFloor(Rectangle, Random::RandomStream&);
 		
-		void				FillAreaWithRandomWall(Rectangle);
+		void				FillAreaWithRandomWall(Rectangle, Random::RandomStream&);
 
 		void				Reset();
+
+		void				SwapTiles(TileMap&);
 	private:
 		/// <summary> The map data. </summary>
-		std::vector<std::vector<Tile>>	m_data;
+		TileStorage					m_data;
+
+		/// <summary> The changed areas of the map, one set per consumer. </summary>
+		std::vector<DirtyRegions>	m_dirtyRegions;
+
+		/// <summary> The clear cells of the map, which is only built once it is first used. </summary>
+		ClearCellIndex				m_clearCells;
+
+		void						markDirty(Rectangle);
 
-		/// <summary> The width of the tile data. </summary>
-		uint16_t						m_width;
+		template <class GetID> void	fillArea(Rectangle, GetID);
 
-		/// <summary> The height of the tile data. </summary>
-		uint16_t						m_height;
+		ClearCellIndex&				getClearCells();
 	};
 }
 #endif
\ No newline at end of file
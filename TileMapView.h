@@ -0,0 +1,200 @@
+#ifndef TILEMAPVIEW_H
+#define TILEMAPVIEW_H
+
+// Data includes.
+#include "Tile.h"
+#include "Point.h"
+#include "Rectangle.h"
+
+// Utility includes.
+#include "SpriteData.h"
+#include <algorithm>
+
+// Typedef includes.
+#include <stdint.h>
+
+namespace WorldObjects
+{
+	/// <summary> Represents a read-only view over the storage of a <see cref="TileMap"/>, resolved at compile time so that every query can be inlined. </summary>
+	/// <remarks> Used by anything that queries cells in bulk, such as the map generators and the <see cref="Camera"/>. The <see cref="IReadOnlyTileMap"/> interface is a thin adapter over this. </remarks>
+	template <class Storage> class TileMapView
+	{
+	public:
+		/// <summary> Creates a view over the given storage. </summary>
+		/// <param name="_storage"> The storage to view, which must outlive this view. </param>
+		explicit TileMapView(const Storage& _storage) : m_storage(&_storage) {}
+
+		/// <summary> Gets the width of the data. </summary>
+		/// <returns> The width of the data. </returns>
+		inline uint32_t	GetWidth()										const	{ return m_storage->GetWidth(); }
+
+		/// <summary> Gets the height of the data. </summary>
+		/// <returns> The height of the data. </returns>
+		inline uint32_t	GetHeight()										const	{ return m_storage->GetHeight(); }
+
+		/// <summary> Gets the area of the data. </summary>
+		/// <returns> The width multiplied by the height of the data. </returns>
+		inline uint32_t	GetArea()										const	{ return GetWidth() * GetHeight(); }
+
+		/// <summary> Gets the <see cref="Tile"/> at the given position. </summary>
+		/// <param name="_position"> The position whence to get the <see cref="Tile"/>. </param>
+		/// <returns> The <see cref="Tile"/> at the given position. </returns>
+		inline Tile		GetTileAt(const Point _position)				const	{ return m_storage->GetTile(_position.x, _position.y); }
+
+		/// <summary> Returns <c>true</c> if the given position is in range; otherwise, <c>false</c>. </summary>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the given position is in range; otherwise, <c>false</c>. </returns>
+		inline bool		IsCellInRange(const Point _position)			const	{ return _position.x >= 0 && _position.x < (int32_t)GetWidth() && _position.y >= 0 && _position.y < (int32_t)GetHeight(); }
+
+		/// <summary> Returns <c>true</c> if the given position is in the playable range; otherwise, <c>false</c>. </summary>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the given position is in the playable range; otherwise, <c>false</c>. </returns>
+		inline bool		IsCellInPlayableArea(const Point _position)		const	{ return _position.x > 0 && _position.x < (int32_t)GetWidth() - 1 && _position.y > 0 && _position.y < (int32_t)GetHeight() - 1; }
+
+		/// <summary> Checks if the <see cref="Tile"/> at the given position is empty. </summary>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the given position is empty; otherwise, <c>false</c>. </returns>
+		inline bool		IsCellClear(const Point _position)				const	{ return SpriteData::IsFloor(m_storage->GetID(_position.x, _position.y)); }
+
+		/// <summary> Checks if the <see cref="Tile"/> at the given position is empty and on the map. </summary>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the given position is empty and on the map; otherwise, <c>false</c>. </returns>
+		inline bool		IsCellClearAndInRange(const Point _position)	const	{ return IsCellInRange(_position) && IsCellClear(_position); }
+
+		/// <summary> Checks if the <see cref="Tile"/> at the given position is blocked. </summary>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the given position is blocked; otherwise, <c>false</c>. </returns>
+		inline bool		IsCellBlocked(const Point _position)			const	{ return SpriteData::IsWall(m_storage->GetID(_position.x, _position.y)); }
+
+		/// <summary> Checks if the <see cref="Tile"/> at the given position is blocked and on the map. </summary>
+		/// <param name="_position"> The position to check. </param>
+		/// <returns> <c>true</c> if the given position is blocked and on the map; otherwise, <c>false</c>. </returns>
+		inline bool		IsCellBlockedAndInRange(const Point _position)	const	{ return IsCellInRange(_position) && IsCellBlocked(_position); }
+
+		/// <summary> Finds if the given area is floored. </summary>
+		/// <param name="_area"> The area to check. </param>
+		/// <returns> <c>true</c> if not a single blocked cell exists within the given area, <c>false</c> otherwise. </returns>
+		bool AreaIsClear(const Rectangle _area) const
+		{
+			// Cells outside of the map are neither clear nor blocked, so only check the part of the area on the map.
+			Rectangle clippedArea = ClipToMap(_area);
+
+			// Check each cell in the area row by row, a run at a time, if any are blocked, return false.
+			for (int32_t y = clippedArea.y; y < clippedArea.GetMaxY(); y++)
+			{
+				for (int32_t x = clippedArea.x; x < clippedArea.GetMaxX(); x += Storage::GetRunLength(x, clippedArea.GetMaxX()))
+				{
+					// Untouched chunks are entirely walls, so the area cannot be clear.
+					const uint8_t* run = m_storage->GetIDRun(x, y);
+					if (run == NULL) { return false; }
+
+					for (int32_t i = 0; i < Storage::GetRunLength(x, clippedArea.GetMaxX()); i++) { if (SpriteData::IsWall(run[i])) { return false; } }
+				}
+			}
+
+			// If every cell is clear, the area is clear.
+			return true;
+		}
+
+		/// <summary> Finds if the given area is walled. </summary>
+		/// <param name="_area"> The area to check. </param>
+		/// <returns> <c>true</c> if not a single clear cell exists within the given area, <c>false</c> otherwise. </returns>
+		bool AreaIsBlocked(const Rectangle _area) const
+		{
+			// Cells outside of the map are neither clear nor blocked, so only check the part of the area on the map.
+			Rectangle clippedArea = ClipToMap(_area);
+
+			// Check each cell in the area row by row, a run at a time, if any are clear, return false.
+			for (int32_t y = clippedArea.y; y < clippedArea.GetMaxY(); y++)
+			{
+				for (int32_t x = clippedArea.x; x < clippedArea.GetMaxX(); x += Storage::GetRunLength(x, clippedArea.GetMaxX()))
+				{
+					// Untouched chunks are entirely walls, so can be skipped.
+					const uint8_t* run = m_storage->GetIDRun(x, y);
+					if (run == NULL) { continue; }
+
+					for (int32_t i = 0; i < Storage::GetRunLength(x, clippedArea.GetMaxX()); i++) { if (SpriteData::IsFloor(run[i])) { return false; } }
+				}
+			}
+
+			// If every cell is blocked, the area is blocked.
+			return true;
+		}
+
+		/// <summary> Clips the given area so that it only covers cells on the map. </summary>
+		/// <param name="_area"> The area to clip. </param>
+		/// <returns> The part of the given area that is on the map, with a size of <c>0</c> if none of it is. </returns>
+		Rectangle ClipToMap(const Rectangle _area) const
+		{
+			int32_t minX = std::max(0, _area.x);
+			int32_t minY = std::max(0, _area.y);
+			int32_t maxX = std::min((int32_t)GetWidth(), _area.GetMaxX());
+			int32_t maxY = std::min((int32_t)GetHeight(), _area.GetMaxY());
+
+			return Rectangle(minX, minY, std::max(0, maxX - minX), std::max(0, maxY - minY));
+		}
+
+		/// <summary> Calls the given function with the ID of every cell within the given area, going along each row. </summary>
+		/// <param name="_area"> The area to visit, which is clipped to the map. </param>
+		/// <param name="_visit"> The function, taking the position and ID of each cell. </param>
+		/// <remarks> Reads each row a run at a time, so the chunk of a cell is only looked up once for each chunk a row crosses. </remarks>
+		template <class Visitor> void VisitIDs(const Rectangle _area, Visitor _visit) const
+		{
+			Rectangle clippedArea = ClipToMap(_area);
+			for (int32_t y = clippedArea.y; y < clippedArea.GetMaxY(); y++)
+			{
+				for (int32_t x = clippedArea.x; x < clippedArea.GetMaxX(); x += Storage::GetRunLength(x, clippedArea.GetMaxX()))
+				{
+					int32_t length = Storage::GetRunLength(x, clippedArea.GetMaxX());
+					const uint8_t* run = m_storage->GetIDRun(x, y);
+					if (run == NULL) { run = Storage::GetUntouchedIDRun(x, y); }
+
+					for (int32_t i = 0; i < length; i++) { _visit(Point(x + i, y), run[i]); }
+				}
+			}
+		}
+
+		/// <summary> Calls the given function with the <see cref="Tile"/> of every cell within the given area, going along each row. </summary>
+		/// <param name="_area"> The area to visit, which is clipped to the map. </param>
+		/// <param name="_visit"> The function, taking the position and <see cref="Tile"/> of each cell. </param>
+		/// <remarks> Reads each row a run at a time, so the chunk of a cell is only looked up once for each chunk a row crosses. </remarks>
+		template <class Visitor> void VisitTiles(const Rectangle _area, Visitor _visit) const
+		{
+			Rectangle clippedArea = ClipToMap(_area);
+			for (int32_t y = clippedArea.y; y < clippedArea.GetMaxY(); y++)
+			{
+				for (int32_t x = clippedArea.x; x < clippedArea.GetMaxX(); x += Storage::GetRunLength(x, clippedArea.GetMaxX()))
+				{
+					int32_t length = Storage::GetRunLength(x, clippedArea.GetMaxX());
+					typename Storage::TileRun run = m_storage->GetTileRun(x, y);
+
+					if (run.m_IDs == NULL)	{ const uint8_t* IDs = Storage::GetUntouchedIDRun(x, y); for (int32_t i = 0; i < length; i++) { _visit(Point(x + i, y), Tile(IDs[i], 0, false)); } }
+					else					{ for (int32_t i = 0; i < length; i++, run.m_visibilities >>= 1) { _visit(Point(x + i, y), Tile(run.m_IDs[i], run.m_prosperities[i], (run.m_visibilities & 1) != 0)); } }
+				}
+			}
+		}
+
+		/// <summary> Calls the given function with the position of every clear cell within the given area, going along each row. </summary>
+		/// <param name="_area"> The area to visit, which is clipped to the map. </param>
+		/// <param name="_visit"> The function, taking the position of each clear cell. </param>
+		/// <remarks> Untouched chunks are entirely walls, so they are skipped without reading any cell. </remarks>
+		template <class Visitor> void VisitClearCells(const Rectangle _area, Visitor _visit) const
+		{
+			Rectangle clippedArea = ClipToMap(_area);
+			for (int32_t y = clippedArea.y; y < clippedArea.GetMaxY(); y++)
+			{
+				for (int32_t x = clippedArea.x; x < clippedArea.GetMaxX(); x += Storage::GetRunLength(x, clippedArea.GetMaxX()))
+				{
+					const uint8_t* run = m_storage->GetIDRun(x, y);
+					if (run == NULL) { continue; }
+
+					for (int32_t i = 0; i < Storage::GetRunLength(x, clippedArea.GetMaxX()); i++) { if (SpriteData::IsFloor(run[i])) { _visit(Point(x + i, y)); } }
+				}
+			}
+		}
+	private:
+		/// <summary> The storage being viewed. </summary>
+		const Storage* m_storage;
+	};
+}
+#endif
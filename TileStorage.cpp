@@ -0,0 +1,72 @@
+#include "TileStorage.h"
+
+// Utility includes.
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+// Make the pattern of untouched walls before anything can read it.
+const std::array<uint8_t, WorldObjects::TileStorage::c_untouchedPatternSize * WorldObjects::TileStorage::c_untouchedPatternSize> WorldObjects::TileStorage::s_untouchedPattern = WorldObjects::TileStorage::createUntouchedPattern();
+
+// The shared untouched chunk is zeroed, so it has no prosperity or visibility.
+WorldObjects::TileStorage::Chunk WorldObjects::TileStorage::s_untouchedChunk = WorldObjects::TileStorage::Chunk();
+
+/// <summary> Creates new <see cref="TileStorage"/> with the given width and height, with every chunk untouched. </summary>
+/// <param name="_width"> The width of the data. </param>
+/// <param name="_height"> The height of the data. </param>
+WorldObjects::TileStorage::TileStorage(const uint32_t _width, const uint32_t _height) : m_width(_width), m_height(_height)
+{
+	// If the size is empty or too large for the area to be held, throw an error.
+	if (_width == 0 || _height == 0 || _width > c_maxSize || _height > c_maxSize) { throw std::exception("Tile map size is out of range."); }
+
+	// Point each chunk at the untouched chunk, rounding up so that the edges of the data are covered.
+	m_chunksWide = (_width + c_chunkMask) >> c_chunkShift;
+	m_chunks.resize(m_chunksWide * ((_height + c_chunkMask) >> c_chunkShift), &s_untouchedChunk);
+}
+
+/// <summary> Releases every chunk, so that every cell is an undiscovered plain wall without prosperity. </summary>
+void WorldObjects::TileStorage::Clear()
+{
+	std::fill(m_chunks.begin(), m_chunks.end(), &s_untouchedChunk);
+	m_touchedChunks.clear();
+}
+
+/// <summary> Counts how many chunks have been touched and allocated. </summary>
+/// <returns> The amount of allocated chunks. </returns>
+uint32_t WorldObjects::TileStorage::GetAllocatedChunkAmount() const
+{
+	return (uint32_t)m_touchedChunks.size();
+}
+
+/// <summary> Creates a chunk with the values of an untouched chunk. </summary>
+/// <param name="_chunkX"> The x of the top-left cell of the chunk. </param>
+/// <param name="_chunkY"> The y of the top-left cell of the chunk. </param>
+/// <returns> The created chunk, which is owned by <see cref="m_touchedChunks"/>. </returns>
+WorldObjects::TileStorage::Chunk* WorldObjects::TileStorage::createChunk(const int32_t _chunkX, const int32_t _chunkY)
+{
+	m_touchedChunks.emplace_back(new Chunk());
+	Chunk* chunk = m_touchedChunks.back().get();
+
+	// Copy the IDs from the same walls that were read while the chunk was untouched, a row at a time. The other planes are zeroed by the value-initialisation.
+	for (int32_t y = 0; y < c_chunkSize; y++) { std::memcpy(&chunk->m_IDs[y << c_chunkShift], GetUntouchedIDRun(_chunkX, _chunkY + y), c_chunkSize); }
+
+	return chunk;
+}
+
+/// <summary> Creates the pattern of untouched walls. </summary>
+/// <returns> A plain wall for each cell of the pattern, varied by a hash of its position. </returns>
+std::array<uint8_t, WorldObjects::TileStorage::c_untouchedPatternSize * WorldObjects::TileStorage::c_untouchedPatternSize> WorldObjects::TileStorage::createUntouchedPattern()
+{
+	std::array<uint8_t, c_untouchedPatternSize * c_untouchedPatternSize> pattern;
+	for (int32_t y = 0; y < c_untouchedPatternSize; y++)
+	{
+		for (int32_t x = 0; x < c_untouchedPatternSize; x++)
+		{
+			uint32_t hash = (uint32_t)x * 0x9E3779B1u ^ (uint32_t)y * 0x85EBCA77u;
+			hash ^= hash >> 15;
+			pattern[y * c_untouchedPatternSize + x] = (uint8_t)(SpriteData::TileID::Wall1 + ((hash * 0xC2B2AE3Du) >> 30));
+		}
+	}
+
+	return pattern;
+}
@@ -0,0 +1,265 @@
+#ifndef TILESTORAGE_H
+#define TILESTORAGE_H
+
+// Data includes.
+#include "Tile.h"
+
+// Utility includes.
+#include "SpriteData.h"
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <memory>
+
+// Typedef includes.
+#include <stdint.h>
+
+namespace WorldObjects
+{
+	/// <summary> Represents the raw data of a <see cref="TileMap"/>, split into square chunks that are only allocated once something is written to them. </summary>
+	/// <remarks> Cells within an unallocated chunk read as undiscovered plain walls without prosperity, so untouched areas of a large map cost a single pointer per chunk. Performs no range checking, that is left to the <see cref="TileMap"/> itself. </remarks>
+	class TileStorage
+	{
+	public:
+		/// <summary> The amount of bits to shift a cell position by to get the position of its chunk. </summary>
+		static const int32_t c_chunkShift = 6;
+
+		/// <summary> The width and height of a chunk, in cells. </summary>
+		static const int32_t c_chunkSize = 1 << c_chunkShift;
+
+		/// <summary> The mask to apply to a cell position to get its position within its chunk. </summary>
+		static const int32_t c_chunkMask = c_chunkSize - 1;
+
+		/// <summary> The widest or highest the data can be, which keeps the area within 32 bits. </summary>
+		static const uint32_t c_maxSize = 65535;
+
+		/// <summary> Represents the cells of one row of a chunk from a given cell to the end of the chunk, so that a row can be read with one chunk lookup for each chunk it crosses. </summary>
+		struct TileRun
+		{
+			/// <summary> The ID of each cell, or <c>NULL</c> if the chunk is untouched, in which case each ID is <see cref="GetUntouchedID"/>. </summary>
+			const uint8_t*	m_IDs;
+
+			/// <summary> The prosperity of each cell, or <c>NULL</c> if the chunk is untouched, in which case each prosperity is <c>0</c>. </summary>
+			const uint8_t*	m_prosperities;
+
+			/// <summary> The visibility of each cell, with the first cell in the lowest bit. </summary>
+			uint64_t		m_visibilities;
+		};
+
+		/// <summary> Represents the cells of one row of a chunk from a given cell to the end of the chunk, so that a row can be written with one chunk lookup for each chunk it crosses. </summary>
+		struct WritableTileRun
+		{
+			/// <summary> The ID of each cell. </summary>
+			uint8_t*		m_IDs;
+
+			/// <summary> The prosperity of each cell. </summary>
+			uint8_t*		m_prosperities;
+
+			/// <summary> The visibility of the whole row of the chunk, one bit per cell. </summary>
+			uint64_t*		m_visibilities;
+
+			/// <summary> The bit within <see cref="m_visibilities"/> of the first cell. </summary>
+			int32_t			m_firstBit;
+		};
+
+		TileStorage(uint32_t, uint32_t);
+
+		/// <summary> Gets the width of the data. </summary>
+		/// <returns> The width of the data. </returns>
+		inline uint32_t	GetWidth()																const	{ return m_width; }
+
+		/// <summary> Gets the height of the data. </summary>
+		/// <returns> The height of the data. </returns>
+		inline uint32_t	GetHeight()																const	{ return m_height; }
+
+		/// <summary> Gets the ID of the cell at the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The ID of the cell. </returns>
+		inline uint8_t	GetID(const int32_t _x, const int32_t _y)								const	{ const Chunk* chunk = getChunk(_x, _y); return (chunk != &s_untouchedChunk) ? chunk->m_IDs[getLocalIndex(_x, _y)] : GetUntouchedID(_x, _y); }
+
+		/// <summary> Gets the prosperity of the cell at the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The prosperity of the cell. </returns>
+		inline uint8_t	GetProsperity(const int32_t _x, const int32_t _y)						const	{ return getChunk(_x, _y)->m_prosperities[getLocalIndex(_x, _y)]; }
+
+		/// <summary> Gets the visibility of the cell at the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> <c>true</c> if the cell has been discovered; otherwise, <c>false</c>. </returns>
+		inline bool		GetVisibility(const int32_t _x, const int32_t _y)						const	{ return (getChunk(_x, _y)->m_visibilities[_y & c_chunkMask] & ((uint64_t)1 << (_x & c_chunkMask))) != 0; }
+
+		/// <summary> Gets the cell at the given position as a single <see cref="Tile"/>. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The <see cref="Tile"/> made from each plane. </returns>
+		inline Tile		GetTile(const int32_t _x, const int32_t _y)								const	{ return Tile(GetID(_x, _y), GetProsperity(_x, _y), GetVisibility(_x, _y)); }
+
+		/// <summary> Gets a pointer to the ID of the cell at the given position, from which the rest of the row within the same chunk can be scanned without recalculating the index for each cell. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> A pointer to the ID of the cell, valid for the next <c>c_chunkSize - (_x & c_chunkMask)</c> cells, or <c>NULL</c> if the chunk is untouched. </returns>
+		inline const uint8_t* GetIDRun(const int32_t _x, const int32_t _y)						const	{ const Chunk* chunk = getChunk(_x, _y); return (chunk != &s_untouchedChunk) ? &chunk->m_IDs[getLocalIndex(_x, _y)] : NULL; }
+
+		/// <summary> Gets every plane of the cells from the given position to the end of its chunk's row. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The run of cells, valid for the next <c>c_chunkSize - (_x & c_chunkMask)</c> cells. </returns>
+		inline TileRun	GetTileRun(const int32_t _x, const int32_t _y)							const
+		{
+			const Chunk* chunk = getChunk(_x, _y);
+			if (chunk == &s_untouchedChunk) { return TileRun{ NULL, NULL, 0 }; }
+
+			uint32_t localIndex = getLocalIndex(_x, _y);
+			return TileRun{ &chunk->m_IDs[localIndex], &chunk->m_prosperities[localIndex], chunk->m_visibilities[_y & c_chunkMask] >> (_x & c_chunkMask) };
+		}
+
+		/// <summary> Gets every plane of the cells from the given position to the end of its chunk's row to write to, allocating the chunk if it has not yet been touched. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The run of cells, valid for the next <c>c_chunkSize - (_x & c_chunkMask)</c> cells. </returns>
+		inline WritableTileRun GetWritableTileRun(const int32_t _x, const int32_t _y)
+		{
+			Chunk& chunk = getOrCreateChunk(_x, _y);
+			uint32_t localIndex = getLocalIndex(_x, _y);
+			return WritableTileRun{ &chunk.m_IDs[localIndex], &chunk.m_prosperities[localIndex], &chunk.m_visibilities[_y & c_chunkMask], _x & c_chunkMask };
+		}
+
+		/// <summary> Sets the ID of the cell at the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <param name="_ID"> The new ID. </param>
+		inline void		SetID(const int32_t _x, const int32_t _y, const uint8_t _ID)
+		{
+			// Writing the untouched value into an untouched chunk changes nothing, so do not allocate it.
+			if (getChunk(_x, _y) == &s_untouchedChunk && _ID == GetUntouchedID(_x, _y)) { return; }
+			getOrCreateChunk(_x, _y).m_IDs[getLocalIndex(_x, _y)] = _ID;
+		}
+
+		/// <summary> Sets the prosperity of the cell at the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <param name="_prosperity"> The new prosperity. </param>
+		inline void		SetProsperity(const int32_t _x, const int32_t _y, const uint8_t _prosperity)
+		{
+			if (getChunk(_x, _y) == &s_untouchedChunk && _prosperity == 0) { return; }
+			getOrCreateChunk(_x, _y).m_prosperities[getLocalIndex(_x, _y)] = _prosperity;
+		}
+
+		/// <summary> Sets the visibility of the cell at the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <param name="_visibility"> The new visibility. </param>
+		inline void		SetVisibility(const int32_t _x, const int32_t _y, const bool _visibility)
+		{
+			if (getChunk(_x, _y) == &s_untouchedChunk && !_visibility) { return; }
+
+			uint64_t& row = getOrCreateChunk(_x, _y).m_visibilities[_y & c_chunkMask];
+			if (_visibility)	{ row |= (uint64_t)1 << (_x & c_chunkMask); }
+			else				{ row &= ~((uint64_t)1 << (_x & c_chunkMask)); }
+		}
+
+		void			Clear();
+
+		uint32_t		GetAllocatedChunkAmount() const;
+
+		/// <summary> Calculates how many cells from the given x can be read as a single run. </summary>
+		/// <param name="_x"> The x from which to read. </param>
+		/// <param name="_maxX"> The x at which to stop reading. </param>
+		/// <returns> The amount of cells until the end of the chunk or the given max x, whichever is closer. </returns>
+		static inline int32_t GetRunLength(const int32_t _x, const int32_t _maxX) { return std::min(c_chunkSize - (_x & c_chunkMask), _maxX - _x); }
+
+		/// <summary> Gets a pointer to the ID that the cell at the given position has while its chunk is untouched, from which the rest of the row within the same chunk can be read. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> A pointer into the pattern of plain walls, valid for the next <c>c_chunkSize - (_x & c_chunkMask)</c> cells. </returns>
+		/// <remarks> Each chunk reads its own window of the pattern, picked by a hash of the chunk's position, so that untouched areas neither look uniform nor repeat from one chunk to the next. </remarks>
+		static inline const uint8_t* GetUntouchedIDRun(const int32_t _x, const int32_t _y)
+		{
+			uint32_t hash = ((uint32_t)_x >> c_chunkShift) * 0x9E3779B1u ^ ((uint32_t)_y >> c_chunkShift) * 0x85EBCA77u;
+			hash ^= hash >> 15;
+			hash *= 0xC2B2AE3Du;
+
+			uint32_t windowX = hash >> (32 - c_chunkShift), windowY = (hash >> (32 - 2 * c_chunkShift)) & c_chunkMask;
+			return &s_untouchedPattern[(windowY + (_y & c_chunkMask)) * c_untouchedPatternSize + windowX + (_x & c_chunkMask)];
+		}
+
+		/// <summary> Gets the ID that a cell within an untouched chunk has. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> A plain wall, taken from the pattern of untouched walls. </returns>
+		static inline uint8_t GetUntouchedID(const int32_t _x, const int32_t _y) { return *GetUntouchedIDRun(_x, _y); }
+	private:
+		/// <summary> The width and height of the pattern of untouched walls, which is large enough to hold a chunk at any offset up to a chunk. </summary>
+		static const int32_t c_untouchedPatternSize = c_chunkSize * 2;
+
+		/// <summary> The plain walls that untouched chunks read from, going along each row, which is made once when the program starts. </summary>
+		static const std::array<uint8_t, c_untouchedPatternSize * c_untouchedPatternSize> s_untouchedPattern;
+
+		/// <summary> Represents a square block of cells, with each property held within its own contiguous, row-major plane. </summary>
+		struct Chunk
+		{
+			/// <summary> The ID of each cell. </summary>
+			uint8_t		m_IDs[c_chunkSize * c_chunkSize];
+
+			/// <summary> The prosperity of each cell. </summary>
+			uint8_t		m_prosperities[c_chunkSize * c_chunkSize];
+
+			/// <summary> The visibility of each cell, with one word per row. </summary>
+			uint64_t	m_visibilities[c_chunkSize];
+		};
+
+		/// <summary> The chunk that every untouched chunk points to, which has no prosperity or visibility, so that reading them needs no check. Its IDs are never read. </summary>
+		static Chunk s_untouchedChunk;
+
+		/// <summary> The width of the data. </summary>
+		uint32_t							m_width;
+
+		/// <summary> The height of the data. </summary>
+		uint32_t							m_height;
+
+		/// <summary> The amount of chunks along each row. </summary>
+		uint32_t							m_chunksWide;
+
+		/// <summary> Every chunk in row-major order, where chunks that have not yet been touched point to <see cref="s_untouchedChunk"/>. </summary>
+		std::vector<Chunk*>					m_chunks;
+
+		/// <summary> The chunks that have been touched, which own the memory that <see cref="m_chunks"/> points to. </summary>
+		std::vector<std::unique_ptr<Chunk>>	m_touchedChunks;
+
+		/// <summary> Calculates the index into <see cref="m_chunks"/> of the chunk that holds the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The index of the chunk. </returns>
+		inline uint32_t		getChunkIndex(const int32_t _x, const int32_t _y)						const	{ return ((uint32_t)_y >> c_chunkShift) * m_chunksWide + ((uint32_t)_x >> c_chunkShift); }
+
+		/// <summary> Gets the chunk that holds the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The chunk, or <see cref="s_untouchedChunk"/> if it has not yet been touched. </returns>
+		inline const Chunk*	getChunk(const int32_t _x, const int32_t _y)							const	{ return m_chunks[getChunkIndex(_x, _y)]; }
+
+		/// <summary> Gets the chunk that holds the given position, allocating it if it has not yet been touched. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The chunk. </returns>
+		inline Chunk&		getOrCreateChunk(const int32_t _x, const int32_t _y)
+		{
+			Chunk*& chunk = m_chunks[getChunkIndex(_x, _y)];
+			if (chunk == &s_untouchedChunk) { chunk = createChunk(_x & ~c_chunkMask, _y & ~c_chunkMask); }
+			return *chunk;
+		}
+
+		Chunk* createChunk(int32_t, int32_t);
+
+		static std::array<uint8_t, c_untouchedPatternSize * c_untouchedPatternSize> createUntouchedPattern();
+
+		/// <summary> Calculates the index into each plane of a chunk of the given position. </summary>
+		/// <param name="_x"> The x of the position. </param>
+		/// <param name="_y"> The y of the position. </param>
+		/// <returns> The index of the cell within its chunk. </returns>
+		static inline uint32_t getLocalIndex(const int32_t _x, const int32_t _y)								{ return ((uint32_t)(_y & c_chunkMask) << c_chunkShift) | (uint32_t)(_x & c_chunkMask); }
+	};
+}
+#endif
@@ -1,6 +1,11 @@
 #ifndef TOOL_H
 #define TOOL_H
 
+// Utility includes.
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
 // Typedef includes.
 #include <stdint.h>
 
@@ -15,10 +20,26 @@ namespace Minigames
 		/// <summary> How many layers are destroyed at a time with this <see cref="Tool"/>. </summary>
 		uint8_t m_power;
 
+		/// <summary> The damage dealt to each tile of this <see cref="Tool"/>'s effect going along each row, which falls off by one for each step away from the middle. </summary>
+		std::vector<uint8_t> m_stencil;
+
 		/// <summary> Creates a new <see cref="Tool"/> with the given size and power. </summary>
 		/// <param name="_size"> The size of the tool's effect. </param>
 		/// <param name="_power"> The power of the tool. </param>
-		Tool(const uint8_t _size, const uint8_t _power) : m_size(_size), m_power(_power) {}
+		Tool(const uint8_t _size, const uint8_t _power) : m_size(_size), m_power(_power), m_stencil(_size * _size)
+		{
+			// Work out the damage of each tile once, as it never changes.
+			for (int32_t y = 0; y < _size; y++)
+			{
+				for (int32_t x = 0; x < _size; x++) { m_stencil[y * _size + x] = (uint8_t)std::max(0, _power - std::abs(x - _size / 2) - std::abs(y - _size / 2)); }
+			}
+		}
+
+		/// <summary> Gets the damage dealt to the tile at the given offset from the top-left of this <see cref="Tool"/>'s effect. </summary>
+		/// <param name="_x"> The x of the offset. </param>
+		/// <param name="_y"> The y of the offset. </param>
+		/// <returns> The damage dealt to the tile. </returns>
+		inline uint8_t GetDamageAt(const int32_t _x, const int32_t _y) const { return m_stencil[_y * m_size + _x]; }
 	};
 }
-#endif
\ No newline at end of file
+#endif
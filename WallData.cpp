@@ -1,76 +1,148 @@
 #include "WallData.h"
 
-// Data includes.
-#include "Direction.h"
-
 // Utility includes.
-#include "Random.h"
+#include <algorithm>
 
 /// <summary> Creates a new <see cref="WallData"/> with the given width and height. </summary>
 /// <param name="_width"> The width of the data. </param>
 /// <param name="_height"> The height of the data. </param>
 Minigames::WallData::WallData(const uint8_t _width, const uint8_t _height) : m_width(_width), m_height(_height), m_bounds(0, 0, _width, _height)
 {
-	// Initialise the rows and columns.
-	m_data = std::vector<std::vector<uint8_t>>(m_width);
-	for (int32_t x = 0; x < m_width; x++) { m_data[x] = std::vector<uint8_t>(m_height); }
+	// Initialise the data and the buffers used to generate each bump.
+	m_data = std::vector<uint8_t>(m_width * m_height);
+	m_bumpNoise = std::vector<float_t>(((m_width - 1) / c_noiseSpacing + 2) * ((m_height - 1) / c_noiseSpacing + 2));
+	m_bumpSteps = std::vector<uint16_t>(m_width * m_height);
+	m_distanceCounts = std::vector<uint16_t>((size_t)std::ceil(std::sqrt((float_t)(m_width * m_width + m_height * m_height)) * (1 + c_noiseStrength) * c_distanceSteps) + 1);
+	m_stepHeights = std::vector<uint8_t>(m_distanceCounts.size());
+
+	// Initialise the layers, with room for every value.
+	m_layerCells = std::vector<std::vector<uint16_t>>(c_maxValue + 1);
+	m_layerSlots = std::vector<uint16_t>(m_width * m_height);
+	buildLayers();
 }
 
 /// <summary> Generates a random cave wall. </summary>
-void Minigames::WallData::Generate()
+/// <param name="_random"> The random stream to draw from. </param>
+void Minigames::WallData::Generate(Random::RandomStream& _random)
 {
 	// Reset the data to the minimum value.
 	reset();
 
 	// Create a random number of bumps.
-	uint8_t numberOfBumps = Random::RandomBetween(4, 6);
-	for (int32_t i = 0; i < numberOfBumps; i++) { generateBump((c_maxValue - numberOfBumps) + i); }
+	uint8_t numberOfBumps = _random.Between(4, 6);
+	for (int32_t i = 0; i < numberOfBumps; i++) { generateBump((c_maxValue - numberOfBumps) + i, _random); }
+
+	// Sort the cells into their layers.
+	buildLayers();
+}
+
+/// <summary> Sets the value of the data at the given position to the given value, moving the cell to the layer of the new value. </summary>
+/// <param name="_x"> The x of the position. </param>
+/// <param name="_y"> The y of the position. </param>
+/// <param name="_value"> The value to set, from <c>0</c> to <see cref="c_maxValue"/>. </param>
+void Minigames::WallData::SetValueAt(const uint8_t _x, const uint8_t _y, const uint8_t _value)
+{
+	// If the position is out of range or the value is unchanged, do nothing.
+	uint16_t cellIndex = _y * m_width + _x;
+	if (!IsInRange(_x, _y) || m_data[cellIndex] == _value) { return; }
+
+	// Remove the cell from its old layer by moving the last cell of that layer into its slot.
+	std::vector<uint16_t>& oldLayer = m_layerCells[m_data[cellIndex]];
+	uint16_t slot = m_layerSlots[cellIndex];
+	oldLayer[slot] = oldLayer.back();
+	m_layerSlots[oldLayer[slot]] = slot;
+	oldLayer.pop_back();
+
+	// Add the cell to the end of its new layer.
+	std::vector<uint16_t>& newLayer = m_layerCells[_value];
+	m_layerSlots[cellIndex] = (uint16_t)newLayer.size();
+	newLayer.push_back(cellIndex);
+
+	m_data[cellIndex] = _value;
 }
 
 /// <summary> Resets the data to the minimum value. </summary>
 void Minigames::WallData::reset()
 {
-	for (int32_t x = 0; x < m_width; x++)
+	std::fill(m_data.begin(), m_data.end(), c_minValue);
+}
+
+/// <summary> Sorts every cell into the layer of its value, going along each row so that each layer is drawn in order. </summary>
+void Minigames::WallData::buildLayers()
+{
+	// Empty each layer, keeping the memory.
+	for (size_t l = 0; l < m_layerCells.size(); l++) { m_layerCells[l].clear(); }
+
+	for (int32_t y = 0; y < m_height; y++)
 	{
-		for (int32_t y = 0; y < m_height; y++)
+		for (int32_t x = 0; x < m_width; x++)
 		{
-			m_data[x][y] = c_minValue;
+			std::vector<uint16_t>& layer = m_layerCells[m_data[y * m_width + x]];
+			m_layerSlots[y * m_width + x] = (uint16_t)layer.size();
+			layer.push_back((uint16_t)(y * m_width + x));
 		}
 	}
 }
 
 /// <summary> Generates a random bump on the cave wall from the given height. </summary>
+/// <remarks> The bump is a rough mound, each layer of which adds a random amount of cells around the layer above it, going down to the minimum value.
+/// Every cell is given its distance from the middle of the bump stretched by coarse noise, then the cells are counted by distance to find the height at each distance, so that the whole bump takes two passes over the wall. </remarks>
 /// <param name="_height"> The starting height of the bump. </param>
-void Minigames::WallData::generateBump(const uint8_t _height)
+/// <param name="_random"> The random stream to draw from. </param>
+void Minigames::WallData::generateBump(const uint8_t _height, Random::RandomStream& _random)
 {
-	// Set the current height to the given height.
-	uint8_t currentHeight = _height;
-
-	// Much like the cavern generation, start at a random place and randomly move around.
-	Point currentPosition(Random::RandomBetween(0, m_width - 1), Random::RandomBetween(0, m_height - 1));
-	Point nextPosition;
+	// Start at a random place.
+	Point middle(_random.Between(0, m_width - 1), _random.Between(0, m_height - 1));
 
-	// Every time a placement cannot be made, increment this by 1 to prevent an infinite loop.
-	int32_t currentAttempts = 0;
+	// Fill the noise all at once.
+	uint16_t noiseWidth = (m_width - 1) / c_noiseSpacing + 2;
+	_random.FillScalar(m_bumpNoise.data(), m_bumpNoise.size());
 
-	// Keep going until a certain height is reached.
-	while (currentHeight > c_minValue && currentAttempts < c_maxAttempts)
+	// Find the stretched distance of each cell from the middle, and count how many cells fall into each step of distance.
+	std::fill(m_distanceCounts.begin(), m_distanceCounts.end(), 0);
+	for (uint16_t y = 0; y < m_height; y++)
 	{
-		// Only set the tile if it is lower than the current height, otherwise increment the attempt counter.
-		if (m_data[currentPosition.x][currentPosition.y] < currentHeight)
+		float_t blendY = (y % c_noiseSpacing) / (float_t)c_noiseSpacing;
+		const float_t* topNoise = &m_bumpNoise[(y / c_noiseSpacing) * noiseWidth];
+		const float_t* bottomNoise = topNoise + noiseWidth;
+		float_t offsetY = (float_t)(y - middle.y);
+
+		// Go along the row one noise point at a time, blending between the four noise points around each cell.
+		uint16_t x = 0;
+		for (uint16_t noiseX = 0; x < m_width; noiseX++)
 		{
-			// Set the tile.
-			m_data[currentPosition.x][currentPosition.y] = currentHeight;
+			float_t leftNoise = topNoise[noiseX] + (bottomNoise[noiseX] - topNoise[noiseX]) * blendY;
+			float_t rightNoise = topNoise[noiseX + 1] + (bottomNoise[noiseX + 1] - topNoise[noiseX + 1]) * blendY;
+
+			for (uint8_t step = 0; step < c_noiseSpacing && x < m_width; step++, x++)
+			{
+				float_t noise = leftNoise + (rightNoise - leftNoise) * (step / (float_t)c_noiseSpacing);
+				float_t offsetX = (float_t)(x - middle.x);
+				uint16_t distanceStep = (uint16_t)(int32_t)(std::sqrt(offsetX * offsetX + offsetY * offsetY) * (1 + c_noiseStrength * (noise * 2 - 1)) * c_distanceSteps);
 
-			// Roll to go down one layer and reset the attempt counter.
-			if (Random::RandomScalar() < c_downChance && currentHeight > 0) { currentHeight--; currentAttempts = 0; }
+				m_bumpSteps[y * m_width + x] = distanceStep;
+				m_distanceCounts[distanceStep]++;
+			}
 		}
-		else { currentAttempts++; }
+	}
 
-		// Keep going in a random direction until a valid move is found.
-		do { nextPosition = currentPosition + Direction::GetRandom().GetNormal(); } while (!m_bounds.IsPointInside(nextPosition));
+	// Go out through the counted distances, giving each step the height of the layer that reaches it.
+	// Each layer reaches out until it holds a random amount of cells more than the layer above, with the average being the given area.
+	uint8_t height = _height;
+	float_t totalArea = -std::log(1 - _random.Scalar()) * c_averageLayerArea;
+	uint32_t cellsWithin = 0;
+	for (size_t distanceStep = 0; distanceStep < m_distanceCounts.size(); distanceStep++)
+	{
+		while (height > c_minValue && cellsWithin >= totalArea)
+		{
+			height--;
+			totalArea -= std::log(1 - _random.Scalar()) * c_averageLayerArea;
+		}
 
-		// Make the move.
-		currentPosition = nextPosition;
+		cellsWithin += m_distanceCounts[distanceStep];
+		m_stepHeights[distanceStep] = height;
 	}
+
+	// Raise each cell to the height of its step.
+	for (size_t i = 0; i < m_data.size(); i++) { m_data[i] = std::max(m_data[i], m_stepHeights[m_bumpSteps[i]]); }
 }
@@ -6,6 +6,7 @@
 #include "Point.h"
 
 // Utility includes.
+#include "Random.h"
 #include <vector>
 
 // Typedef includes.
@@ -15,6 +16,7 @@
 namespace Minigames
 {
 	/// <summary> Represents the data for the wall in the mining minigame. </summary>
+	/// <remarks> The values are kept in one list going along each row, so the index of a cell is the same as the one used by its layer. </remarks>
 	class WallData
 	{
 	public:
@@ -26,24 +28,34 @@ namespace Minigames
 
 		WallData(uint8_t, uint8_t);
 
-		void Generate();
+		void Generate(Random::RandomStream&);
 
 		/// <summary> Gets the value of the data at the given position. </summary>
 		/// <param name="_x"> The x of the position. </param>
 		/// <param name="_y"> The y of the position. </param>
 		/// <returns> The value of the data at the given position. </returns>
-		inline uint8_t GetValueAt(const uint8_t _x, const uint8_t _y)				const	{ return (IsInRange(_x, _y)) ? m_data[_x][_y] : 0; }
+		inline uint8_t GetValueAt(const uint8_t _x, const uint8_t _y)				const	{ return (IsInRange(_x, _y)) ? m_data[_y * m_width + _x] : 0; }
 
 		/// <summary> Gets the value of the data at the given position. </summary>
 		/// <param name="_position"> The position. </param>
 		/// <returns> The value of the data at the given position. </returns>
-		inline uint8_t GetValueAt(const Point _position)							const	{ return (IsInRange(_position)) ? m_data[_position.x][_position.y] : 0; }
+		inline uint8_t GetValueAt(const Point _position)							const	{ return (IsInRange(_position)) ? m_data[_position.y * m_width + _position.x] : 0; }
 
-		/// <summary> Sets the value of the data at the given position to the given value. </summary>
-		/// <param name="_x"> The x of the position. </param>
-		/// <param name="_y"> The y of the position. </param>
-		/// <param name="_value"> The value to set. </param>
-		inline void SetValueAt(const uint8_t _x, const uint8_t _y, const uint8_t _value)	{ if (IsInRange(_x, _y)) { m_data[_x][_y] = _value;} }
+		void SetValueAt(uint8_t, uint8_t, uint8_t);
+
+		/// <summary> Gets the value of every cell, going along each row. </summary>
+		/// <returns> The values, where the value of a cell is at its index as given by <see cref="GetLayerCells"/>. </returns>
+		inline const uint8_t* GetValues()											const	{ return m_data.data(); }
+
+		/// <summary> Gets every cell with the given value, in no particular order. </summary>
+		/// <param name="_layer"> The value, from <c>0</c> to <see cref="c_maxValue"/>. </param>
+		/// <returns> The index of each cell on the layer, which can be turned into a position with <see cref="GetCellPosition"/>. </returns>
+		inline const std::vector<uint16_t>& GetLayerCells(const uint8_t _layer)		const	{ return m_layerCells[_layer]; }
+
+		/// <summary> Gets the position of the cell with the given index. </summary>
+		/// <param name="_cellIndex"> The index of the cell, as given by <see cref="GetLayerCells"/>. </param>
+		/// <returns> The position of the cell. </returns>
+		inline Point GetCellPosition(const uint16_t _cellIndex)						const	{ return Point(_cellIndex % m_width, _cellIndex / m_width); }
 
 		/// <summary> Finds if the given position is in range of the data. </summary>
 		/// <param name="_x"> The x of the position. </param>
@@ -64,11 +76,17 @@ namespace Minigames
 		/// <returns> The height of the data. </returns>
 		inline uint8_t GetHeight()													const	{ return m_height; }
 	private:
-		/// <summary> The chance for a bump to go down one layer, set really low as this is rolled a lot. <c>0</c> for no chance, <c>1</c> for full chance. </summary>
-		const float_t	c_downChance = 0.001f;
+		/// <summary> The average amount of cells that each layer of a bump adds to it. </summary>
+		const float_t	c_averageLayerArea = 1000.0f;
+
+		/// <summary> The distance in cells between the points of the noise that roughens the edges of a bump. </summary>
+		const uint8_t	c_noiseSpacing = 8;
+
+		/// <summary> How much the noise can stretch the distance of a cell from the middle of a bump, from <c>0</c> for a perfect circle. </summary>
+		const float_t	c_noiseStrength = 0.6f;
 
-		/// <summary> The most attempts that will be made to place a tile at a given layer. </summary>
-		const uint16_t	c_maxAttempts = 20000;
+		/// <summary> How many steps each cell of distance is split into when sorting the cells of a bump by distance. </summary>
+		const uint8_t	c_distanceSteps = 4;
 
 		/// <summary> The width of the data. </summary>
 		uint8_t			m_width;
@@ -79,12 +97,32 @@ namespace Minigames
 		/// <summary> The bounds of the data. </summary>
 		Rectangle		m_bounds;
 
-		/// <summary> The data itself. </summary>
-		std::vector<std::vector<uint8_t>> m_data;
+		/// <summary> The data itself, going along each row. </summary>
+		std::vector<uint8_t> m_data;
+
+		/// <summary> The index of every cell on each layer, where the layer of a cell is its value. </summary>
+		std::vector<std::vector<uint16_t>> m_layerCells;
+
+		/// <summary> The slot of each cell within the list of its layer, so that a cell can be moved between layers without searching. </summary>
+		std::vector<uint16_t> m_layerSlots;
+
+		/// <summary> The noise for the bump being generated, with one point every <see cref="c_noiseSpacing"/> cells. </summary>
+		std::vector<float_t> m_bumpNoise;
+
+		/// <summary> The step of distance of each cell from the middle of the bump being generated, stretched by the noise. </summary>
+		std::vector<uint16_t> m_bumpSteps;
+
+		/// <summary> How many cells of the bump being generated fall into each step of distance. </summary>
+		std::vector<uint16_t> m_distanceCounts;
+
+		/// <summary> The height of the bump being generated at each step of distance. </summary>
+		std::vector<uint8_t> m_stepHeights;
 		
 		void reset();
 
-		void generateBump(uint8_t);
+		void buildLayers();
+
+		void generateBump(uint8_t, Random::RandomStream&);
 	};
 }
 #endif
\ No newline at end of file
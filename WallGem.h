@@ -51,6 +51,10 @@ namespace Minigames
 		/// <returns> <c>true</c> if this <see cref="WallGem"/> is completely uncovered; otherwise, <c>false</c>. </returns>
 		inline bool IsFullyUncovered(WallData& _wallData) const { return m_collider.IsFullyUncovered(m_wallPosition, m_wallLayer, _wallData); }
 
+		/// <summary> Calls the given function with each cell of the cave wall that has to be mined below the layer of this <see cref="WallGem"/> for it to be uncovered. </summary>
+		/// <param name="_visitor"> Called with the wall position of each cell. </param>
+		template <class Visitor> void VisitCoverCells(Visitor _visitor) const { const Point wallPosition = m_wallPosition; m_collider.VisitCoverCells([&_visitor, wallPosition](const Point _position) { _visitor(wallPosition + _position); }); }
+
 		/// <summary> Finds if the given position on the cave wall is within this <see cref="WallGem"/>. </summary>
 		/// <param name="_wallPosition"> The wall position. </param>
 		/// <returns> <c>true</c> if the position collides with this <see cref="WallGem"/>; otherwise, <c>false</c>. </returns>
@@ -73,6 +77,10 @@ namespace Minigames
 		/// <returns> The height of this <see cref="WallGem"/>. </returns>
 		inline uint8_t GetHeight() const { return m_collider.GetHeight(); }
 
+		/// <summary> Gets the collider of this <see cref="WallGem"/>. </summary>
+		/// <returns> The <see cref="GemCollider"/> of this <see cref="WallGem"/>. </returns>
+		inline const GemCollider& GetCollider() const { return m_collider; }
+
 		/// <summary> Gets the layer of this <see cref="WallGem"/>. </summary>
 		/// <returns> The layer of this <see cref="WallGem"/>. </returns>
 		inline uint8_t GetLayer() const { return m_wallLayer; }
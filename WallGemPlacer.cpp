@@ -0,0 +1,141 @@
+#include "WallGemPlacer.h"
+
+// Utility includes.
+#include <algorithm>
+
+/// <summary> Places gems into the given wall until their value uses up the given prosperity, or until no gem fits. </summary>
+/// <remarks> A gem, layer, and position is drawn with the same chance as drawing each at random and retrying until the gem fits, but without ever retrying the same position. </remarks>
+/// <param name="_wallData"> The wall. </param>
+/// <param name="_prosperity"> The total value of the gems to place. </param>
+/// <param name="_random"> The random stream used to place the gems. </param>
+/// <param name="_wallGems"> The list to which each placed gem is added. </param>
+void Minigames::WallGemPlacer::Place(const WallData& _wallData, const uint32_t _prosperity, Random::RandomStream& _random, std::vector<WallGem>& _wallGems)
+{
+	// Find where each gem can go on each layer, then start with nothing occupied.
+	buildCandidates(_wallData);
+	m_occupiedRows.assign(getRowStart(0, _wallData.c_maxValue + 1), 0);
+
+	// Find how many positions each gem could be placed at before checking the wall, so each gem is drawn as often as it would be if its position was drawn at random.
+	double_t positionCounts[c_gemCount];
+	for (uint8_t gemID = 0; gemID < c_gemCount; gemID++)
+	{
+		GemCollider collider = GemCollider::GetGemColliderFromGemID((SpriteData::GemID)gemID);
+		positionCounts[gemID] = (double_t)(m_width - collider.GetWidth() + 1) * (m_height - collider.GetHeight() + 1);
+	}
+
+	int32_t remainingProsperity = (int32_t)_prosperity;
+	while (remainingProsperity > 0)
+	{
+		// Weigh each gem and layer by the share of its positions that are still candidates.
+		double_t totalWeight = 0;
+		for (size_t i = 0; i < m_candidates.size(); i++) { totalWeight += m_candidates[i].size() / positionCounts[i / _wallData.c_maxValue]; }
+
+		// If no candidates remain, the wall is full.
+		if (totalWeight <= 0) { break; }
+
+		// Pick the gem and layer, falling back to the last with any candidates if rounding carries the target past the end.
+		double_t target = _random.Scalar() * totalWeight;
+		size_t candidateList = m_candidates.size();
+		for (size_t i = 0; i < m_candidates.size(); i++)
+		{
+			if (m_candidates[i].empty()) { continue; }
+			candidateList = i;
+			target -= m_candidates[i].size() / positionCounts[i / _wallData.c_maxValue];
+			if (target < 0) { break; }
+		}
+
+		// Pick the position, and remove it from the candidates as it never needs to be drawn again.
+		std::vector<uint16_t>& candidates = m_candidates[candidateList];
+		uint32_t candidate = (uint32_t)_random.Between(0, (int32_t)candidates.size() - 1);
+		Point position(candidates[candidate] % m_width, candidates[candidate] / m_width);
+		candidates[candidate] = candidates.back();
+		candidates.pop_back();
+
+		// If the position is taken by another gem on the same layer, draw again.
+		WallGem gem(position, (uint8_t)(candidateList % _wallData.c_maxValue + 1), (SpriteData::GemID)(candidateList / _wallData.c_maxValue));
+		if (isOccupied(position, gem.GetLayer(), gem.GetCollider())) { continue; }
+
+		// Take the cells of the gem, add it, and reduce the remaining prosperity.
+		occupy(position, gem.GetLayer(), gem.GetCollider());
+		remainingProsperity -= gem.GetValue();
+		_wallGems.push_back(gem);
+	}
+}
+
+/// <summary> Finds every position where each gem is fully covered by the given wall on each layer. </summary>
+/// <param name="_wallData"> The wall. </param>
+void Minigames::WallGemPlacer::buildCandidates(const WallData& _wallData)
+{
+	m_width = _wallData.GetWidth();
+	m_height = _wallData.GetHeight();
+	m_wordsPerRow = (m_width + 63) / 64 + 1;
+
+	// The wall is one list going along each row, so the cells of a gem are a fixed offset from its position.
+	const uint8_t* values = _wallData.GetValues();
+
+	// Start every list empty, reusing the memory from the last wall.
+	m_candidates.resize(c_gemCount * _wallData.c_maxValue);
+	for (size_t i = 0; i < m_candidates.size(); i++) { m_candidates[i].clear(); }
+
+	for (uint8_t gemID = 0; gemID < c_gemCount; gemID++)
+	{
+		GemCollider collider = GemCollider::GetGemColliderFromGemID((SpriteData::GemID)gemID);
+
+		// Find the offset of each cell that has to be covered.
+		m_coverOffsets.clear();
+		collider.VisitCoverCells([this](const Point _cell) { m_coverOffsets.push_back((uint16_t)(_cell.y * m_width + _cell.x)); });
+
+		for (uint16_t y = 0; y + collider.GetHeight() <= m_height; y++)
+		{
+			for (uint16_t x = 0; x + collider.GetWidth() <= m_width; x++)
+			{
+				// The gem is covered on every layer up to the lowest cell over it.
+				uint16_t positionIndex = y * m_width + x;
+				uint8_t lowestValue = _wallData.c_maxValue;
+				for (size_t i = 0; i < m_coverOffsets.size() && lowestValue > 0; i++) { lowestValue = std::min(lowestValue, values[positionIndex + m_coverOffsets[i]]); }
+
+				for (uint8_t layer = 1; layer <= lowestValue; layer++) { m_candidates[gemID * _wallData.c_maxValue + layer - 1].push_back(positionIndex); }
+			}
+		}
+	}
+}
+
+/// <summary> Finds if any cell of the given collider at the given position is taken by a gem on the given layer. </summary>
+/// <param name="_position"> The position of the collider. </param>
+/// <param name="_layer"> The layer. </param>
+/// <param name="_collider"> The collider. </param>
+/// <returns> <c>true</c> if any cell is taken; otherwise, <c>false</c>. </returns>
+bool Minigames::WallGemPlacer::isOccupied(const Point _position, const uint8_t _layer, const GemCollider& _collider) const
+{
+	size_t word = _position.x / 64;
+	uint8_t bit = _position.x % 64;
+
+	for (uint8_t y = 0; y < _collider.GetHeight(); y++)
+	{
+		// Shift the occupied cells under the collider down to the start of the row, pulling in the next word if the collider crosses into it.
+		size_t rowStart = getRowStart(_position.y + y, _layer) + word;
+		uint64_t occupied = m_occupiedRows[rowStart] >> bit;
+		if (bit > 64 - GemCollider::c_maxSize) { occupied |= m_occupiedRows[rowStart + 1] << (64 - bit); }
+
+		if ((occupied & _collider.GetRow(y)) != 0) { return true; }
+	}
+
+	return false;
+}
+
+/// <summary> Takes every cell of the given collider at the given position on the given layer. </summary>
+/// <param name="_position"> The position of the collider. </param>
+/// <param name="_layer"> The layer. </param>
+/// <param name="_collider"> The collider. </param>
+void Minigames::WallGemPlacer::occupy(const Point _position, const uint8_t _layer, const GemCollider& _collider)
+{
+	size_t word = _position.x / 64;
+	uint8_t bit = _position.x % 64;
+
+	for (uint8_t y = 0; y < _collider.GetHeight(); y++)
+	{
+		size_t rowStart = getRowStart(_position.y + y, _layer) + word;
+		m_occupiedRows[rowStart] |= (uint64_t)_collider.GetRow(y) << bit;
+		if (bit > 64 - GemCollider::c_maxSize) { m_occupiedRows[rowStart + 1] |= (uint64_t)_collider.GetRow(y) >> (64 - bit); }
+	}
+}
@@ -0,0 +1,65 @@
+#ifndef WALLGEMPLACER_H
+#define WALLGEMPLACER_H
+
+// Data includes.
+#include "Point.h"
+#include "WallData.h"
+#include "WallGem.h"
+#include "GemCollider.h"
+
+// Utility includes.
+#include "Random.h"
+#include "SpriteData.h"
+#include <vector>
+
+// Typedef includes.
+#include <stdint.h>
+
+namespace Minigames
+{
+	/// <summary> Places gems into a wall, so that every gem is fully covered and no two gems on the same layer overlap. </summary>
+	/// <remarks> Every position where each gem would be fully covered on each layer is found from the wall up front, then gems are drawn from those candidates.
+	/// Each layer keeps a grid of occupied cells as one bitmask per row, so a drawn candidate is checked against the gems on its layer a row at a time.
+	/// A candidate is removed once drawn, whether it was placed or was blocked, so placing always ends once the candidates run out. </remarks>
+	class WallGemPlacer
+	{
+	public:
+		WallGemPlacer() : m_coverOffsets(), m_candidates(), m_occupiedRows(), m_width(0), m_height(0), m_wordsPerRow(0) {}
+
+		void Place(const WallData&, uint32_t, Random::RandomStream&, std::vector<WallGem>&);
+	private:
+		/// <summary> The amount of different gems. </summary>
+		static const uint8_t			c_gemCount = SpriteData::GemID::Emerald + 1;
+
+		/// <summary> The offset from the position of the current gem of each cell checked to see if the current gem is covered. </summary>
+		std::vector<uint16_t>			m_coverOffsets;
+
+		/// <summary> The index of each position, going along each row, where each gem is fully covered on each layer, with the lists for a gem being one after another by layer. </summary>
+		std::vector<std::vector<uint16_t>>	m_candidates;
+
+		/// <summary> The cells taken by a gem on each layer, with one bit per cell going along each row. </summary>
+		std::vector<uint64_t>			m_occupiedRows;
+
+		/// <summary> The width of the wall. </summary>
+		uint16_t						m_width;
+
+		/// <summary> The height of the wall. </summary>
+		uint16_t						m_height;
+
+		/// <summary> The amount of words in each row of <see cref="m_occupiedRows"/>, with one more than needed so that a gem at the end of a row can always read the next word. </summary>
+		uint16_t						m_wordsPerRow;
+
+		void buildCandidates(const WallData&);
+
+		bool isOccupied(Point, uint8_t, const GemCollider&) const;
+
+		void occupy(Point, uint8_t, const GemCollider&);
+
+		/// <summary> Gets the first word of the given row of the given layer in <see cref="m_occupiedRows"/>. </summary>
+		/// <param name="_y"> The row. </param>
+		/// <param name="_layer"> The layer. </param>
+		/// <returns> The index of the first word of the row. </returns>
+		inline size_t getRowStart(const int32_t _y, const uint8_t _layer) const { return ((size_t)_layer * m_height + _y) * m_wordsPerRow; }
+	};
+}
+#endif
@@ -13,9 +13,12 @@
 #include "Screen.h"
 
 // Utility includes.
-#include "Random.h"
+#include "RandomService.h"
 #include "AudioData.h"
 
+// World includes.
+#include "FieldOfView.h"
+
 // Map generation includes.
 #include "CavernGenerator.h"
 #include "DungeonGenerator.h"
@@ -46,22 +49,78 @@ void WorldObjects::World::Initialise(Events::Events& _events)
 }
 
 /// <summary> Resets the world to its starting state. </summary>
-void WorldObjects::World::Reset()
+/// <param name="_services"> The service provider. </param>
+void WorldObjects::World::Reset(Services::ServiceProvider& _services)
 {
+	// Stop generating the next floor of the last game.
+	cancelNextFloor();
+
 	m_floorCount = 0;
 	m_player.GetInventory().Reset();
-	generateRandomMap();
+
+	// Make the seed of this game from the generation stream, which every floor is made from so that the floors only depend on the seed.
+	Random::RandomStream& random = _services.GetService<Random::RandomService>(Services::ServiceType::Random).GetStream(Random::StreamType::Generation);
+	m_gameSeed = ((uint64_t)random.Next() << 32) | random.Next();
+
+	// Generate the first floor now, then start generating the next while this one is played.
+	generateFloor(getFloorSeed(0), m_tileData, m_spawnPoint, m_exitPoint, m_isNextFloorCancelled);
+	startFloor();
+	startNextFloor();
+}
+
+/// <summary> Places the player on the spawn of the floor that was just generated and sets up the floor. </summary>
+void WorldObjects::World::startFloor()
+{
+	// Move the player to the spawn.
+	m_player.SetTilePosition(m_spawnPoint.GetTilePosition());
+
+	// Set the remaining turns.
+	m_turnsUntilCollapse = std::max(ceil((m_tileData.GetWidth() + m_tileData.GetHeight()) * 1.5f), ceil((m_tileData.GetWidth() + m_tileData.GetHeight()) * 3.0f) - (m_floorCount * 5.0f));
+
+	// Uncover the seen tiles.
+	uncoverTiles();
 }
 
-/// <summary> Generates a random map and places the player on the spawn. </summary>
-void WorldObjects::World::generateRandomMap()
+/// <summary> Starts generating the floor after the current one on another thread, if there is one. </summary>
+void WorldObjects::World::startNextFloor()
 {
+	// If this is the last floor, there is nothing to generate.
+	if (m_floorCount + 1 >= c_floorAmount) { return; }
+
+	m_isNextFloorCancelled = false;
+	m_nextFloorThread = std::thread(&World::generateFloor, getFloorSeed(m_floorCount + 1), std::ref(m_nextTileData), std::ref(m_nextSpawnPoint), std::ref(m_nextExitPoint), std::cref(m_isNextFloorCancelled));
+}
+
+/// <summary> Stops generating the next floor as soon as possible and waits for the thread to finish. </summary>
+void WorldObjects::World::cancelNextFloor()
+{
+	if (!m_nextFloorThread.joinable()) { return; }
+
+	m_isNextFloorCancelled = true;
+	m_nextFloorThread.join();
+
+	// Clear the flag once the thread has stopped, as the same flag is used when the first floor of the next game is generated.
+	m_isNextFloorCancelled = false;
+}
+
+/// <summary> Generates a random floor from the given seed onto the given map. </summary>
+/// <param name="_seed"> The seed of the floor, the same seed always makes the same floor. </param>
+/// <param name="_map"> The map on which to generate. </param>
+/// <param name="_spawn"> The spawn object. </param>
+/// <param name="_exit"> The exit object. </param>
+/// <param name="_cancelFlag"> The flag that stops the generation when set. </param>
+/// <remarks> Only touches the given objects, so that it can be run on another thread. </remarks>
+void WorldObjects::World::generateFloor(const uint64_t _seed, TileMap& _map, GameObjects::MapObject& _spawn, GameObjects::MapObject& _exit, const std::atomic<bool>& _cancelFlag)
+{
+	// Create the stream for this floor.
+	Random::RandomStream random(_seed);
+
 	// Initialise the start and end points.
-	m_spawnPoint.SetTilePosition(Point(0, 0));
-	m_exitPoint.SetTilePosition(Point(0, 0));
+	_spawn.SetTilePosition(Point(0, 0));
+	_exit.SetTilePosition(Point(0, 0));
 
 	// Generate a random percentage to decide which type of map to generate.
-	float mapRoll = Random::RandomScalar();
+	float mapRoll = random.Scalar();
 
 	// Create an interfaced version of the map generator to use.
 	MapGeneration::MapGenerator* mapGenerator = NULL;
@@ -71,18 +130,10 @@ void WorldObjects::World::generateRandomMap()
 	else				{ mapGenerator = new MapGeneration::DungeonGenerator(); }
 
 	// Generate the map then delete the generator, avoid a dangling pointer by setting it to null.
-	mapGenerator->Generate(m_tileData, m_spawnPoint, m_exitPoint);
+	mapGenerator->SetCancelFlag(_cancelFlag);
+	mapGenerator->Generate(_map, random, _spawn, _exit);
 	delete mapGenerator;
 	mapGenerator = NULL;
-
-	// Move the player to the spawn.
-	m_player.SetTilePosition(m_spawnPoint.GetTilePosition());
-
-	// Set the remaining turns.
-	m_turnsUntilCollapse = std::max(ceil((m_tileData.GetWidth() + m_tileData.GetHeight()) * 1.5f), ceil((m_tileData.GetWidth() + m_tileData.GetHeight()) * 3.0f) - (m_floorCount * 5.0f));
-
-	// Uncover the seen tiles.
-	uncoverTiles();
 }
 
 /// <summary> Handles the player pressing a key to move. </summary>
@@ -113,6 +164,9 @@ void WorldObjects::World::handleKeyDown(Events::EventContext* _context)
 	case Controls::Command::MoveDown:	{ handleMovement(*_context->m_services, Directions::Down, mod & KMOD_SHIFT); break; }
 	case Controls::Command::MoveLeft:	{ handleMovement(*_context->m_services, Directions::Left, mod & KMOD_SHIFT); break; }
 	case Controls::Command::MoveRight:	{ handleMovement(*_context->m_services, Directions::Right, mod & KMOD_SHIFT); break; }
+
+	// Every other command is handled elsewhere or does nothing.
+	default:							{ break; }
 	}
 }
 
@@ -136,33 +190,27 @@ void WorldObjects::World::doTurn(Services::ServiceProvider& _services, const uin
 /// <param name="_services"> The service provider. </param>
 void WorldObjects::World::collapse(Services::ServiceProvider& _services)
 {
-	// How many tiles have to be caved in.
-	uint8_t tilesToCollapse = Random::RandomBetween(18, 40);
+	// Get the gameplay stream.
+	Random::RandomStream& random = _services.GetService<Random::RandomService>(Services::ServiceType::Random).GetStream(Random::StreamType::Gameplay);
 
-	// How many attempts to cave a tile in have been made.
-	uint32_t collapseAttempts = 0;
+	// How many tiles have to be caved in.
+	uint8_t tilesToCollapse = random.Between(18, 40);
 
-	// Keep caving in tiles until the limit is reached or no more attempts can be made.
-	while (collapseAttempts < c_maxCollapseAttempts && tilesToCollapse > 0)
+	// Keep caving in tiles until the limit is reached or no clear cell is left.
+	for (; tilesToCollapse > 0; --tilesToCollapse)
 	{
-		// Generate a random position.
-		Point position(Random::RandomBetween(1, m_tileData.GetWidth() - 2), Random::RandomBetween(1, m_tileData.GetHeight() - 2));
+		// Pick a random clear cell, moving on to the next slots if it is the spawn or exit, which are never collapsed.
+		Point position;
+		if (!getCollapsibleCell(random, position)) { break; }
+
+		m_tileData.FillCellWithRandomWall(position, random);
 
-		// If this cell is valid to collapse, collapse it; otherwise, mark it as an attempt.
-		if (m_tileData.IsCellClear(position) && m_spawnPoint.GetTilePosition() != position && m_exitPoint.GetTilePosition() != position) 
+		// If the player was crushed by this tile, send the end game event.
+		if (position == m_player.GetTilePosition()) 
 		{ 
-			m_tileData.FillCellWithRandomWall(position);
-			--tilesToCollapse;
-			collapseAttempts = 0;
-
-			// If the player was crushed by this tile, send the end game event.
-			if (position == m_player.GetTilePosition()) 
-			{ 
-				_services.GetService<Events::Events>(Services::ServiceType::Events).PushEvent(Events::UserEvent::PlayerDied, NULL, NULL);
-				_services.GetService<Audio::Audio>(Services::ServiceType::Audio).PlaySound(AudioData::SoundID::PlayerCrushed);
-			}
+			_services.GetService<Events::Events>(Services::ServiceType::Events).PushEvent(Events::UserEvent::PlayerDied, NULL, NULL);
+			_services.GetService<Audio::Audio>(Services::ServiceType::Audio).PlaySound(AudioData::SoundID::PlayerCrushed);
 		}
-		else { collapseAttempts++; }
 	}
 
 	// Play the collapse sound.
@@ -172,6 +220,44 @@ void WorldObjects::World::collapse(Services::ServiceProvider& _services)
 	_services.GetService<Screens::Screen>(Services::ServiceType::Screen).ShakeScreen(20);
 }
 
+/// <summary> Picks a random clear cell that can be collapsed, which is any clear cell within the playable area other than the spawn and exit. </summary>
+/// <param name="_random"> The random stream to use. </param>
+/// <param name="_position"> Is set to the position of the picked cell. </param>
+/// <returns> <c>true</c> if a cell was picked; otherwise, <c>false</c> if no cell can be collapsed. </returns>
+bool WorldObjects::World::getCollapsibleCell(Random::RandomStream& _random, Point& _position)
+{
+	// If there are no clear cells, nothing can be collapsed.
+	uint32_t clearCellCount = m_tileData.GetClearCellCount();
+	if (clearCellCount == 0) { return false; }
+
+	// Pick random slots until one is neither the spawn nor the exit, so that every other clear cell is as likely as any other.
+	for (uint32_t i = 0; i < c_collapsePicks; i++)
+	{
+		_position = m_tileData.GetClearCell((uint32_t)_random.Between(0, (int32_t)clearCellCount - 1));
+		if (_position != m_spawnPoint.GetTilePosition() && _position != m_exitPoint.GetTilePosition()) { return true; }
+	}
+
+	// If every pick was the spawn or exit, there are very few clear cells, so count the ones that can be collapsed and pick one of them.
+	uint32_t collapsibleCount = 0;
+	for (uint32_t slot = 0; slot < clearCellCount; slot++)
+	{
+		Point position = m_tileData.GetClearCell(slot);
+		if (position != m_spawnPoint.GetTilePosition() && position != m_exitPoint.GetTilePosition()) { collapsibleCount++; }
+	}
+	if (collapsibleCount == 0) { return false; }
+
+	// Go over the clear cells again, stopping at the picked one.
+	uint32_t pick = (uint32_t)_random.Between(0, (int32_t)collapsibleCount - 1);
+	for (uint32_t slot = 0; slot < clearCellCount; slot++)
+	{
+		_position = m_tileData.GetClearCell(slot);
+		if (_position == m_spawnPoint.GetTilePosition() || _position == m_exitPoint.GetTilePosition()) { continue; }
+		if (pick-- == 0) { return true; }
+	}
+
+	return false;
+}
+
 /// <summary> Handles player movement. </summary>
 /// <param name="_services"> The service provider. </param>
 /// <param name="_direction"> The direction in which the player wants to move. </param>
@@ -207,7 +293,7 @@ void WorldObjects::World::handleSwinging(Services::ServiceProvider& _services)
 	// If the cell has no prosperity, destroy it and do a turn, otherwise put the minigame start event onto the event bus.
 	if (m_tileData.GetTileAt(minePosition).m_prosperity == 0) 
 	{
-		m_tileData.FillCellWithRandomFloor(minePosition); 
+		m_tileData.FillCellWithRandomFloor(minePosition, _services.GetService<Random::RandomService>(Services::ServiceType::Random).GetStream(Random::StreamType::Gameplay));
 		doTurn(_services, 2);
 
 		// Play the sound.
@@ -244,8 +330,19 @@ void WorldObjects::World::handleNewFloor(Services::ServiceProvider& _services)
 	// Play the exit sound.
 	_services.GetService<Audio::Audio>(Services::ServiceType::Audio).PlaySound(AudioData::SoundID::UseExit);
 
-	// If the floor will be less than 10, continue on as normal; otherwise, win the game.
-	if (++m_floorCount < 10) { generateRandomMap(); }
+	// If the floor will be less than the last, continue on as normal; otherwise, win the game.
+	if (++m_floorCount < c_floorAmount)
+	{
+		// Wait for the next floor to finish generating, which it usually already has, then swap it in.
+		if (m_nextFloorThread.joinable()) { m_nextFloorThread.join(); }
+		m_tileData.SwapTiles(m_nextTileData);
+		m_spawnPoint.SetTilePosition(m_nextSpawnPoint.GetTilePosition());
+		m_exitPoint.SetTilePosition(m_nextExitPoint.GetTilePosition());
+
+		// Set up the floor, then start generating the one after.
+		startFloor();
+		startNextFloor();
+	}
 	else
 	{
 		// Play the sound for the player winning, and push the won event.
@@ -257,30 +354,8 @@ void WorldObjects::World::handleNewFloor(Services::ServiceProvider& _services)
 /// <summary> Discovers tiles in front of the player. </summary>
 void WorldObjects::World::uncoverTiles()
 {
-	// Get the start of the end points.
-	Point startPosition = (m_player.GetTilePosition() + (m_player.GetFacing().GetNormal() * m_player.GetSightDistance())) + (m_player.GetFacing().GetLeft().GetNormal() * m_player.GetSightDistance());
-
-	// Get the player's central position.
-	Vector2 playerPosition = Vector2(m_player.GetTilePosition().x + 0.5f, m_player.GetTilePosition().y + 0.5f);
-
-	// Repeat for all the end points.
-	for (uint8_t x = 0; x < 1 + m_player.GetSightDistance() * 2; x++)
-	{
-		// Calculate the end point of the line.
-		Point endPoint = startPosition + (m_player.GetFacing().GetRight().GetNormal() * x);
-
-		// Get the cells covered by the line.
-		std::vector<Point> lineOfSight = Point::getCoveredPoints(playerPosition, Vector2(endPoint.x + 0.5f, endPoint.y + 0.5f));
-
-		for (uint16_t p = 0; p < lineOfSight.size(); p++)
-		{
-			// Uncover the tile.
-			m_tileData.SetCellVisiblity(lineOfSight[p], true);
-
-			// If this cell blocks vision, break the line.
-			if (!m_tileData.IsCellClearAndInRange(lineOfSight[p])) { break; }
-		}
-	}
+	// Uncover what the player can see in front of them.
+	FieldOfView::UncoverCone(m_tileData, m_player.GetTilePosition(), m_player.GetFacing(), m_player.GetSightDistance());
 }
 
 /// <summary> Handles breaking the gem wall after the player has finished mining it. </summary>
@@ -291,7 +366,7 @@ void WorldObjects::World::stopMinigame(Events::EventContext* _context)
 	Point tilePosition = *static_cast<Point*>(_context->m_data1);
 
 	// Since the minigame has ended, the cave wall has collapsed, meaning the wall should be destroyed.
-	m_tileData.FillCellWithRandomFloor(tilePosition);
+	m_tileData.FillCellWithRandomFloor(tilePosition, _context->m_services->GetService<Random::RandomService>(Services::ServiceType::Random).GetStream(Random::StreamType::Gameplay));
 
 	// Play the gem wall collapse sound.
 	_context->m_services->GetService<Audio::Audio>(Services::ServiceType::Audio).PlaySound(AudioData::SoundID::GemWallCollapse);
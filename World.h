@@ -18,6 +18,8 @@
 
 // Utility includes.
 #include "SpriteData.h"
+#include <atomic>
+#include <thread>
 
 // Typedef includes.
 #include <stdint.h>
@@ -28,8 +30,19 @@ namespace WorldObjects
 	class World
 	{
 	public:
-		/// <summary> Create an empty world. </summary>
-		World() : m_spawnPoint(SpriteData::ObjectID::Spawn), m_exitPoint(SpriteData::ObjectID::Exit), m_tileData(55, 55) {}
+		/// <summary> The width and height of the map when no size is given. </summary>
+		static const uint32_t c_defaultMapSize = 55;
+
+		/// <summary> Create an empty world with the default map size. </summary>
+		World() : World(c_defaultMapSize, c_defaultMapSize) {}
+
+		/// <summary> Create an empty world with the given map size. </summary>
+		/// <param name="_width"> The width of the map, in tiles. </param>
+		/// <param name="_height"> The height of the map, in tiles. </param>
+		World(const uint32_t _width, const uint32_t _height) : m_spawnPoint(SpriteData::ObjectID::Spawn), m_exitPoint(SpriteData::ObjectID::Exit), m_tileData(_width, _height), m_nextTileData(_width, _height), m_nextSpawnPoint(SpriteData::ObjectID::Spawn), m_nextExitPoint(SpriteData::ObjectID::Exit), m_isNextFloorCancelled(false) {}
+
+		/// <summary> Stops generating the next floor before the world is destroyed. </summary>
+		~World() { cancelNextFloor(); }
 
 		// Prevent copies.
 		World(World&) = delete;
@@ -37,7 +50,7 @@ namespace WorldObjects
 
 		void Initialise(Events::Events&);
 
-		void Reset();
+		void Reset(Services::ServiceProvider&);
 
 		void Draw(Services::ServiceProvider&);
 
@@ -57,6 +70,10 @@ namespace WorldObjects
 		/// <returns> A <see cref="IReadOnlyTileMap"/> form of the data. </returns>
 		inline IReadOnlyTileMap&					GetTileMap()				{ return m_tileData; }
 
+		/// <summary> Gets a compile-time view of the <see cref="TileData"/>, for when many cells are queried at once. </summary>
+		/// <returns> A <see cref="TileMap::View"/> of the data. </returns>
+		inline TileMap::View						GetTileMapView() const		{ return m_tileData.GetView(); }
+
 		/// <summary> Gets the floor the <see cref="Player"/> is on currently. </summary>
 		/// <returns> The floor the <see cref="Player"/> is on currently. </returns>
 		inline uint16_t								GetCurrentLevel() const		{ return m_floorCount; }
@@ -69,12 +86,33 @@ namespace WorldObjects
 		/// <returns> The camera. </returns>
 		inline Camera&								GetCamera()					{ return m_camera; }
 	private:
-		/// <summary> The most attempts that will be made to collapse a tile. </summary>
-		const uint32_t c_maxCollapseAttempts = 5000;
+		/// <summary> The amount of floors, the player wins by using the exit of the last. </summary>
+		const uint16_t c_floorAmount = 10;
+
+		/// <summary> The amount of times a random clear cell is picked when looking for one to collapse, before every clear cell is checked instead. </summary>
+		static const uint32_t c_collapsePicks = 8;
 
 		/// <summary> The tile map data. </summary>
 		TileMap					m_tileData;
 
+		/// <summary> The tile map data of the next floor, which is generated on another thread while the current floor is played. </summary>
+		TileMap					m_nextTileData;
+
+		/// <summary> The entry point of the next floor. </summary>
+		GameObjects::MapObject	m_nextSpawnPoint;
+
+		/// <summary> The exit point of the next floor. </summary>
+		GameObjects::MapObject	m_nextExitPoint;
+
+		/// <summary> The thread generating the next floor, which is not joinable when nothing is being generated. </summary>
+		std::thread				m_nextFloorThread;
+
+		/// <summary> Set to stop the next floor from generating, such as when the game resets. </summary>
+		std::atomic<bool>		m_isNextFloorCancelled;
+
+		/// <summary> The seed of the current game, which every floor seed is made from. </summary>
+		uint64_t				m_gameSeed = 0;
+
 		/// <summary> The player. </summary>
 		GameObjects::Player		m_player;
 
@@ -93,7 +131,18 @@ namespace WorldObjects
 		/// <summary> How many turns the player can make before they lose. </summary>
 		uint16_t				m_turnsUntilCollapse;
 
-		void generateRandomMap();
+		void startFloor();
+
+		void startNextFloor();
+
+		void cancelNextFloor();
+
+		static void generateFloor(uint64_t, TileMap&, GameObjects::MapObject&, GameObjects::MapObject&, const std::atomic<bool>&);
+
+		/// <summary> Gets the seed of the given floor of the current game. </summary>
+		/// <param name="_floor"> The floor, starting at <c>0</c>. </param>
+		/// <returns> The seed of the floor. </returns>
+		inline uint64_t getFloorSeed(const uint16_t _floor) const { return m_gameSeed ^ (0xD1B54A32D192ED03ull * (_floor + 1)); }
 
 		void handleKeyDown(Events::EventContext*);
 
@@ -112,6 +161,8 @@ namespace WorldObjects
 		void doTurn(Services::ServiceProvider&, uint8_t);
 
 		void collapse(Services::ServiceProvider&);
+
+		bool getCollapsibleCell(Random::RandomStream&, Point&);
 	};
 }
 #endif
\ No newline at end of file